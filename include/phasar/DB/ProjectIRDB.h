@@ -165,15 +165,21 @@ public:
    *
    *		<function name>.<id>.o.<operand no>
    *
+   * The representations only depend on the names of the functions and
+   * globals and on the ids of the instructions, hence they identify the same
+   * values in every ProjectIRDB that is constructed from the same IR files.
+   *
    * @brief Creates a unique string representation for any given
-   * llvm::Value.
+   * llvm::Value. Throws std::runtime_error if the value cannot be
+   * represented.
    */
-  std::string valueToPersistedString(const llvm::Value *V);
+  std::string valueToPersistedString(const llvm::Value *V) const;
   /**
    * @brief Convertes the given string back into the llvm::Value it represents.
+   * Throws std::runtime_error if there is no such value.
    * @return Pointer to the converted llvm::Value.
    */
-  const llvm::Value *persistedStringToValue(const std::string &StringRep);
+  const llvm::Value *persistedStringToValue(const std::string &StringRep) const;
   std::set<const llvm::Type *> getAllocatedTypes();
 };
 
@@ -117,7 +117,7 @@ public:
                 const llvm::Module &M, CallGraphAnalysisType CGType,
                 std::vector<std::string> EntryPoints = {});
 
-  ~LLVMBasedICFG() override = default;
+  ~LLVMBasedICFG() override;
 
   std::set<const llvm::Function *> getAllMethods();
 
@@ -17,6 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTION_H_
 
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -38,6 +39,14 @@ public:
 
   virtual bool equal_to(std::shared_ptr<EdgeFunction<V>> other) const = 0;
 
+  /**
+   * Returns a hash value that is equal for edge functions that are
+   * equal_to() each other. Used to share equal edge functions, see
+   * EdgeFunctionMemo. By default, each edge function is only shared with
+   * itself.
+   */
+  virtual size_t hash() const { return std::hash<const void *>()(this); }
+
   virtual void print(std::ostream &OS, bool isForDebug = false) const {
     OS << "EdgeFunction";
   }
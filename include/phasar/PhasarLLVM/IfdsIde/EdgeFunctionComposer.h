@@ -85,6 +85,10 @@ public:
     return false;
   }
 
+  virtual size_t hash() const override {
+    return F->hash() * 31 + G->hash();
+  }
+
   virtual void print(std::ostream &OS, bool isForDebug = false) const override {
     OS << "EFComposer_" << EFComposer_Id << "[ " << F.get()->str() << " , "
        << G.get()->str() << " ]";
@@ -0,0 +1,157 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONMEMO_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONMEMO_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+
+namespace psr {
+
+/**
+ * Hash-conses edge functions and memoizes the results of their composition
+ * and join.
+ *
+ * Edge functions that are equal_to() each other and have the same hash()
+ * value are represented by a single canonical instance. Compositions and
+ * joins are memoized by the identities of their operands. Since results are
+ * canonicalized, repeated compositions of equal functions hit the cache and
+ * comparisons of the results are often answered by pointer equality.
+ *
+ * The memo requires composeWith() and joinWith() to only depend on their
+ * operands. Each of the tables holds at most Capacity entries; a full table
+ * is cleared before new entries are added. A capacity of zero disables
+ * memoization entirely.
+ */
+template <typename V> class EdgeFunctionMemo {
+private:
+  using EFPtr = std::shared_ptr<EdgeFunction<V>>;
+  using Operands = std::pair<EdgeFunction<V> *, EdgeFunction<V> *>;
+
+  struct OperandsHash {
+    size_t operator()(const Operands &Ops) const {
+      return std::hash<EdgeFunction<V> *>()(Ops.first) * 31 +
+             std::hash<EdgeFunction<V> *>()(Ops.second);
+    }
+  };
+
+  struct Result {
+    // keep the operands alive, such that their addresses cannot be reused
+    // by other edge functions while the entry exists
+    EFPtr First;
+    EFPtr Second;
+    EFPtr Value;
+  };
+
+  size_t Capacity;
+  bool Concurrent;
+  std::mutex Mtx;
+  std::unordered_multimap<size_t, EFPtr> Canonical;
+  std::unordered_map<Operands, Result, OperandsHash> Compositions;
+  std::unordered_map<Operands, Result, OperandsHash> Joins;
+
+  std::unique_lock<std::mutex> lock() {
+    return Concurrent ? std::unique_lock<std::mutex>(Mtx)
+                      : std::unique_lock<std::mutex>();
+  }
+
+  EFPtr canonicalizeUnlocked(EFPtr F) {
+    size_t H = F->hash();
+    auto Range = Canonical.equal_range(H);
+    for (auto It = Range.first; It != Range.second; ++It) {
+      if (It->second == F || It->second->equal_to(F)) {
+        return It->second;
+      }
+    }
+    if (Canonical.size() >= Capacity) {
+      Canonical.clear();
+    }
+    Canonical.insert({H, F});
+    return F;
+  }
+
+  template <typename Fn>
+  EFPtr memoize(std::unordered_map<Operands, Result, OperandsHash> &Memo,
+                EFPtr F, EFPtr G, Fn Compute) {
+    if (Capacity == 0) {
+      return Compute();
+    }
+    Operands Key(F.get(), G.get());
+    {
+      auto Lock = lock();
+      auto Search = Memo.find(Key);
+      if (Search != Memo.end()) {
+        return Search->second.Value;
+      }
+    }
+    // compute outside of the lock, since this may be expensive
+    EFPtr Value = Compute();
+    auto Lock = lock();
+    Value = canonicalizeUnlocked(Value);
+    if (Memo.size() >= Capacity) {
+      Memo.clear();
+    }
+    Memo.insert({Key, Result{F, G, Value}});
+    return Value;
+  }
+
+public:
+  EdgeFunctionMemo(size_t Capacity, bool Concurrent = false)
+      : Capacity(Capacity), Concurrent(Concurrent) {}
+
+  ~EdgeFunctionMemo() = default;
+
+  EdgeFunctionMemo(const EdgeFunctionMemo &) = delete;
+
+  EdgeFunctionMemo &operator=(const EdgeFunctionMemo &) = delete;
+
+  /**
+   * Returns the canonical instance of F.
+   */
+  EFPtr canonicalize(EFPtr F) {
+    if (Capacity == 0) {
+      return F;
+    }
+    auto Lock = lock();
+    return canonicalizeUnlocked(F);
+  }
+
+  /**
+   * Returns the canonical instance of F->composeWith(G).
+   */
+  EFPtr compose(EFPtr F, EFPtr G) {
+    return memoize(Compositions, F, G,
+                   [&F, &G]() { return F->composeWith(G); });
+  }
+
+  /**
+   * Returns the canonical instance of F->joinWith(G).
+   */
+  EFPtr join(EFPtr F, EFPtr G) {
+    return memoize(Joins, F, G, [&F, &G]() { return F->joinWith(G); });
+  }
+
+  void clear() {
+    auto Lock = lock();
+    Canonical.clear();
+    Compositions.clear();
+    Joins.clear();
+  }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,316 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONPTR_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONPTR_H_
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/AllBottom.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/AllTop.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
+
+namespace psr {
+
+/**
+ * A value-type handle to an edge function.
+ *
+ * The identity, as well as all-top and all-bottom functions whose value fits
+ * into a pointer and is trivially copyable, are stored inline and dispatched
+ * on a tag, such that copying, composing, joining and comparing them neither
+ * allocates nor touches a reference count. All other edge functions are
+ * held by a std::shared_ptr.
+ *
+ * Handles are created from the std::shared_ptr that problems return, which
+ * recognizes instances of EdgeIdentity, AllTop and AllBottom, and mirror the
+ * semantics of these classes exactly. Since the inline kinds are recognized
+ * exactly, a shared function is never equal to an inline one. get() turns a
+ * handle back into a std::shared_ptr; for all-top and all-bottom functions it
+ * returns the instance that a handle with the same value has been created
+ * from on the calling thread, such that the problem's instance is reused
+ * rather than allocated anew.
+ */
+template <typename V> class EdgeFunctionPtr {
+public:
+  enum class Kind : uint8_t { Identity, AllTop, AllBottom, Shared };
+
+  static constexpr bool IsInline =
+      sizeof(V) <= sizeof(void *) && std::is_trivially_copyable<V>::value;
+
+private:
+  struct NoValue {};
+  using InlineValue = typename std::conditional<IsInline, V, NoValue>::type;
+
+  Kind K;
+  union {
+    InlineValue Value;
+    std::shared_ptr<EdgeFunction<V>> Ptr;
+  };
+
+  EdgeFunctionPtr(Kind K, InlineValue Value) : K(K), Value(Value) {}
+
+  void assign(const EdgeFunctionPtr &F) {
+    K = F.K;
+    if (K == Kind::Shared) {
+      new (&Ptr) std::shared_ptr<EdgeFunction<V>>(F.Ptr);
+    } else {
+      Value = F.Value;
+    }
+  }
+
+  void assign(EdgeFunctionPtr &&F) {
+    K = F.K;
+    if (K == Kind::Shared) {
+      new (&Ptr) std::shared_ptr<EdgeFunction<V>>(std::move(F.Ptr));
+    } else {
+      Value = F.Value;
+    }
+  }
+
+  void destroy() {
+    if (K == Kind::Shared) {
+      Ptr.~shared_ptr();
+    }
+  }
+
+  // the all-top and all-bottom instances that get() hands out; they are kept
+  // per thread, such that handles can be used by several threads at once
+  template <typename T> static std::shared_ptr<T> &canonical() {
+    static thread_local std::shared_ptr<T> Instance;
+    return Instance;
+  }
+
+public:
+  /**
+   * Creates an empty handle, which holds no edge function.
+   */
+  EdgeFunctionPtr() : K(Kind::Shared), Ptr() {}
+
+  EdgeFunctionPtr(std::nullptr_t) : EdgeFunctionPtr() {}
+
+  template <typename T>
+  EdgeFunctionPtr(std::shared_ptr<T> F)
+      : K(Kind::Shared), Ptr(std::move(F)) {
+    EdgeFunction<V> *Raw = Ptr.get();
+    if (!Raw) {
+      return;
+    }
+    if (typeid(*Raw) == typeid(EdgeIdentity<V>)) {
+      Ptr.~shared_ptr();
+      K = Kind::Identity;
+      Value = InlineValue();
+    } else if constexpr (IsInline) {
+      if (typeid(*Raw) == typeid(AllTop<V>)) {
+        V Top = static_cast<AllTop<V> *>(Raw)->getTopElement();
+        auto &Canonical = canonical<AllTop<V>>();
+        if (!Canonical || !(Canonical->getTopElement() == Top)) {
+          Canonical = std::static_pointer_cast<AllTop<V>>(Ptr);
+        }
+        Ptr.~shared_ptr();
+        K = Kind::AllTop;
+        Value = Top;
+      } else if (typeid(*Raw) == typeid(AllBottom<V>)) {
+        V Bottom = static_cast<AllBottom<V> *>(Raw)->getBottomElement();
+        auto &Canonical = canonical<AllBottom<V>>();
+        if (!Canonical || !(Canonical->getBottomElement() == Bottom)) {
+          Canonical = std::static_pointer_cast<AllBottom<V>>(Ptr);
+        }
+        Ptr.~shared_ptr();
+        K = Kind::AllBottom;
+        Value = Bottom;
+      }
+    }
+  }
+
+  EdgeFunctionPtr(const EdgeFunctionPtr &F) { assign(F); }
+
+  EdgeFunctionPtr(EdgeFunctionPtr &&F) noexcept { assign(std::move(F)); }
+
+  EdgeFunctionPtr &operator=(const EdgeFunctionPtr &F) {
+    if (this != &F) {
+      destroy();
+      assign(F);
+    }
+    return *this;
+  }
+
+  EdgeFunctionPtr &operator=(EdgeFunctionPtr &&F) noexcept {
+    if (this != &F) {
+      destroy();
+      assign(std::move(F));
+    }
+    return *this;
+  }
+
+  ~EdgeFunctionPtr() { destroy(); }
+
+  static EdgeFunctionPtr identity() {
+    return EdgeFunctionPtr(Kind::Identity, InlineValue());
+  }
+
+  Kind kind() const { return K; }
+
+  bool isShared() const { return K == Kind::Shared; }
+
+  /**
+   * Returns whether the handle holds an edge function.
+   */
+  explicit operator bool() const { return K != Kind::Shared || Ptr; }
+
+  /**
+   * Returns the edge function as a std::shared_ptr.
+   */
+  std::shared_ptr<EdgeFunction<V>> get() const {
+    switch (K) {
+    case Kind::Identity:
+      return EdgeIdentity<V>::getInstance();
+    case Kind::AllTop:
+      if constexpr (IsInline) {
+        auto &Top = canonical<AllTop<V>>();
+        if (!Top || !(Top->getTopElement() == Value)) {
+          Top = std::make_shared<AllTop<V>>(Value);
+        }
+        return Top;
+      }
+      break;
+    case Kind::AllBottom:
+      if constexpr (IsInline) {
+        auto &Bottom = canonical<AllBottom<V>>();
+        if (!Bottom || !(Bottom->getBottomElement() == Value)) {
+          Bottom = std::make_shared<AllBottom<V>>(Value);
+        }
+        return Bottom;
+      }
+      break;
+    case Kind::Shared:
+      break;
+    }
+    return Ptr;
+  }
+
+  V computeTarget(V Source) const {
+    switch (K) {
+    case Kind::Identity:
+      return Source;
+    case Kind::AllTop:
+    case Kind::AllBottom:
+      if constexpr (IsInline) {
+        return Value;
+      }
+      break;
+    case Kind::Shared:
+      break;
+    }
+    return Ptr->computeTarget(Source);
+  }
+
+  /**
+   * Returns the function that applies this function first and G second,
+   * like EdgeFunction::composeWith().
+   */
+  EdgeFunctionPtr composeWith(const EdgeFunctionPtr &G) const {
+    switch (K) {
+    case Kind::Identity:
+      return G;
+    case Kind::AllTop:
+      return *this;
+    case Kind::AllBottom:
+      return G.K == Kind::Identity ? *this : G;
+    case Kind::Shared:
+      break;
+    }
+    return Ptr->composeWith(G.get());
+  }
+
+  /**
+   * Returns the join of this function and G, like EdgeFunction::joinWith().
+   */
+  EdgeFunctionPtr joinWith(const EdgeFunctionPtr &G) const {
+    switch (K) {
+    case Kind::AllTop:
+      return G;
+    case Kind::AllBottom:
+      return *this;
+    case Kind::Identity:
+      switch (G.K) {
+      case Kind::Identity:
+      case Kind::AllTop:
+        return *this;
+      case Kind::AllBottom:
+        return G;
+      case Kind::Shared:
+        if (G.Ptr->equal_to(get())) {
+          return *this;
+        }
+        // do not know how to join; hence ask the other function
+        return G.Ptr->joinWith(get());
+      }
+      break;
+    case Kind::Shared:
+      break;
+    }
+    return Ptr->joinWith(G.get());
+  }
+
+  bool equal_to(const EdgeFunctionPtr &G) const {
+    if (K == Kind::Shared) {
+      return G.K == Kind::Shared && (Ptr == G.Ptr || Ptr->equal_to(G.Ptr));
+    }
+    if (K != G.K) {
+      return false;
+    }
+    if constexpr (IsInline) {
+      return K == Kind::Identity || Value == G.Value;
+    }
+    return true;
+  }
+
+  void print(std::ostream &OS, bool isForDebug = false) const {
+    switch (K) {
+    case Kind::Identity:
+      OS << "EdgeIdentity";
+      break;
+    case Kind::AllTop:
+      OS << "AllTop";
+      break;
+    case Kind::AllBottom:
+      OS << "AllBottom";
+      break;
+    case Kind::Shared:
+      Ptr->print(OS, isForDebug);
+      break;
+    }
+  }
+
+  std::string str() const {
+    std::ostringstream oss;
+    print(oss);
+    return oss.str();
+  }
+};
+
+template <typename V>
+static inline std::ostream &operator<<(std::ostream &OS,
+                                       const EdgeFunctionPtr<V> &F) {
+  F.print(OS);
+  return OS;
+}
+
+} // namespace psr
+
+#endif
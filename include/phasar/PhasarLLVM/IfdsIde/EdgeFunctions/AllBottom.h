@@ -21,6 +21,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <typeinfo>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 #include <phasar/Utils/Macros.h>
@@ -43,6 +44,8 @@ public:
 
   V computeTarget(V source) override { return bottomElement; }
 
+  V getBottomElement() const { return bottomElement; }
+
   virtual std::shared_ptr<EdgeFunction<V>>
   composeWith(std::shared_ptr<EdgeFunction<V>> secondFunction) override {
     if (EdgeIdentity<V> *ei =
@@ -71,6 +74,11 @@ public:
     return false;
   }
 
+  virtual size_t hash() const override {
+    // all instances share a bucket, there are only a few distinct ones
+    return typeid(AllBottom<V>).hash_code();
+  }
+
   virtual void print(std::ostream &OS, bool isForDebug = false) const override {
     OS << "AllBottom";
   }
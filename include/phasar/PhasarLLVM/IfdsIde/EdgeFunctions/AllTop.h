@@ -19,6 +19,7 @@
 
 #include <iosfwd>
 #include <memory>
+#include <typeinfo>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 
@@ -37,6 +38,8 @@ public:
 
   virtual V computeTarget(V source) override { return topElement; }
 
+  V getTopElement() const { return topElement; }
+
   virtual std::shared_ptr<EdgeFunction<V>>
   composeWith(std::shared_ptr<EdgeFunction<V>> secondFunction) override {
     return this->shared_from_this();
@@ -53,6 +56,11 @@ public:
     return false;
   }
 
+  virtual size_t hash() const override {
+    // all instances share a bucket, there are only a few distinct ones
+    return typeid(AllTop<V>).hash_code();
+  }
+
   virtual void print(std::ostream &OS, bool isForDebug = false) const override {
     OS << "AllTop";
   }
@@ -10,16 +10,24 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWEDGEFUNCTIONCACHE_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWEDGEFUNCTIONCACHE_H_
 
-#include <map>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <shared_mutex>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
-#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionPtr.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <phasar/Utils/CacheRegistry.h>
+#include <phasar/Utils/FlatHashMap.h>
 #include <phasar/Utils/Logger.h>
+#include <phasar/Utils/MonotonicArena.h>
 #include <phasar/Utils/PAMMMacros.h>
 
 namespace psr {
@@ -29,6 +37,25 @@ namespace psr {
  * When a flow or edge function must be applied to multiple times, a cached
  * version is used if existend, otherwise a new one is created and inserted
  * into the cache.
+ *
+ * Edge functions are cached as EdgeFunctionPtr handles, such that trivial
+ * edge functions are recognized once when they are constructed.
+ *
+ * The number of entries per cache can be bounded by
+ * SolverConfiguration::flowEdgeFunctionCacheSize. A full cache evicts entries
+ * using the CLOCK policy, i.e. it evicts the next entry that has not been hit
+ * since the clock hand passed it last. Evicted functions are reconstructed on
+ * demand, which requires the problem to return equivalent functions for equal
+ * arguments.
+ *
+ * Problems that report a cache key share the caches of all solvers that solve
+ * a problem with the same key on the same interprocedural CFG. The caches are
+ * kept in the CacheRegistry until the CFG is released from it.
+ *
+ * If SolverConfiguration::allocateFromArena is set, the functions that are
+ * created for the caches are allocated from a MonotonicArena that belongs to
+ * the caches, and the problem is made to allocate its functions from it as
+ * well. The arena is freed in one go once the caches are destroyed.
  */
 template <typename N, typename D, typename M, typename V, typename I>
 class FlowEdgeFunctionCache {
@@ -37,34 +64,176 @@ private:
   // Auto add zero
   bool autoAddZero;
   D zeroValue;
-  // Caches for the flow functions
-  std::map<std::tuple<N, N>, std::shared_ptr<FlowFunction<D>>>
-      NormalFlowFunctionCache;
-  std::map<std::tuple<N, M>, std::shared_ptr<FlowFunction<D>>>
-      CallFlowFunctionCache;
-  std::map<std::tuple<N, M, N, N>, std::shared_ptr<FlowFunction<D>>>
-      ReturnFlowFunctionCache;
-  std::map<std::tuple<N, N, std::set<M>>, std::shared_ptr<FlowFunction<D>>>
-      CallToRetFlowFunctionCache;
-  // Caches for the edge functions
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      NormalEdgeFunctionCache;
-  std::map<std::tuple<N, D, M, D>, std::shared_ptr<EdgeFunction<V>>>
-      CallEdgeFunctionCache;
-  std::map<std::tuple<N, M, N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      ReturnEdgeFunctionCache;
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      CallToRetEdgeFunctionCache;
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      SummaryEdgeFunctionCache;
+  // Whether the caches must be locked, i.e. if the solver runs with multiple
+  // threads or shares its caches
+  bool Concurrent;
+  // Maximal number of entries per cache, zero if unbounded
+  size_t Capacity;
+  // Whether entries remember their method, such that they can be released
+  bool TrackMethods;
+  // Whether functions are allocated from the arena of the caches
+  bool UseArena;
+
+  template <typename T> struct CacheEntry {
+    T Value;
+    M Method{};
+    // CLOCK reference bit, which is set by cache hits under the shared lock
+    mutable std::atomic<bool> Referenced{false};
+
+    CacheEntry() = default;
+    // new entries count as referenced, otherwise the CLOCK hand, which
+    // rests where the last victim has been removed, could evict them next
+    CacheEntry(T Value, M Method)
+        : Value(std::move(Value)), Method(Method), Referenced(true) {}
+    CacheEntry(const CacheEntry &E)
+        : Value(E.Value), Method(E.Method), Referenced(E.Referenced.load()) {}
+    CacheEntry(CacheEntry &&E) noexcept
+        : Value(std::move(E.Value)), Method(E.Method),
+          Referenced(E.Referenced.load()) {}
+    CacheEntry &operator=(const CacheEntry &E) {
+      Value = E.Value;
+      Method = E.Method;
+      Referenced = E.Referenced.load();
+      return *this;
+    }
+    CacheEntry &operator=(CacheEntry &&E) noexcept {
+      Value = std::move(E.Value);
+      Method = E.Method;
+      Referenced = E.Referenced.load();
+      return *this;
+    }
+  };
+
+  // The maps store the hash value of each key next to it, so that a lookup
+  // is a single probe that compares only keys with equal hash values.
+  template <typename T, typename... Ts> struct Cache {
+    FlatHashMap<std::tuple<Ts...>, CacheEntry<T>, TupleHash> Entries;
+    // position of the CLOCK hand in Entries
+    size_t Hand = 0;
+  };
+  template <typename... Ts>
+  using FFCache = Cache<std::shared_ptr<FlowFunction<D>>, Ts...>;
+  template <typename... Ts> using EFCache = Cache<EdgeFunctionPtr<V>, Ts...>;
+  // The caches may be shared with the caches of other solvers via the
+  // CacheRegistry, see IFDSTabulationProblem::getCacheKey().
+  struct Caches {
+    // declared first, such that it outlives the functions allocated from it
+    MonotonicArena Arena;
+    // guards the caches; cache hits only require a shared lock
+    std::shared_mutex Mtx;
+    // Caches for the flow functions
+    FFCache<N, N> NormalFlowFunctionCache;
+    FFCache<N, M> CallFlowFunctionCache;
+    FFCache<N, M, N, N> ReturnFlowFunctionCache;
+    // The callees are determined by the call site, hence the call site and
+    // the return site suffice as a key.
+    FFCache<N, N> CallToRetFlowFunctionCache;
+    FFCache<N, M> SummaryFlowFunctionCache;
+    // Caches for the edge functions
+    EFCache<N, D, N, D> NormalEdgeFunctionCache;
+    EFCache<N, D, M, D> CallEdgeFunctionCache;
+    EFCache<N, M, N, D, N, D> ReturnEdgeFunctionCache;
+    EFCache<N, D, N, D> CallToRetEdgeFunctionCache;
+    EFCache<N, D, N, D> SummaryEdgeFunctionCache;
+
+    Caches(size_t NumThreads) : Arena(NumThreads) {}
+  };
+  std::shared_ptr<Caches> Store;
+
+  std::shared_lock<std::shared_mutex> readLock() {
+    return Concurrent ? std::shared_lock<std::shared_mutex>(Store->Mtx)
+                      : std::shared_lock<std::shared_mutex>();
+  }
+
+  std::unique_lock<std::shared_mutex> writeLock() {
+    return Concurrent ? std::unique_lock<std::shared_mutex>(Store->Mtx)
+                      : std::unique_lock<std::shared_mutex>();
+  }
+
+  template <typename T, typename... ArgTs>
+  std::shared_ptr<T> makeFunction(ArgTs &&... Args) {
+    if (UseArena) {
+      return Store->Arena.template makeShared<T>(std::forward<ArgTs>(Args)...);
+    }
+    return std::make_shared<T>(std::forward<ArgTs>(Args)...);
+  }
+
+  M methodOf(N n) {
+    return TrackMethods ? problem.interproceduralCFG().getMethodOf(n) : M{};
+  }
+
+  // Requires at least the shared lock.
+  template <typename T, typename... Ts>
+  T *lookup(Cache<T, Ts...> &C, const std::tuple<Ts...> &Key) {
+    if (auto *Entry = C.Entries.find(Key)) {
+      Entry->Referenced.store(true, std::memory_order_relaxed);
+      return &Entry->Value;
+    }
+    return nullptr;
+  }
+
+  // Requires the exclusive lock. Evicts an entry that has not been referenced
+  // since the CLOCK hand passed it last if the cache is full.
+  template <typename T, typename... Ts>
+  T insert(Cache<T, Ts...> &C, const std::tuple<Ts...> &Key, T Value,
+           M Method) {
+    if (auto *Entry = C.Entries.find(Key)) {
+      return Entry->Value;
+    }
+    if (Capacity != 0 && C.Entries.size() >= Capacity) {
+      PAMM_GET_INSTANCE;
+      C.Entries.eraseNextIf(
+          C.Hand, [](const std::tuple<Ts...> &, CacheEntry<T> &E) {
+            return !E.Referenced.exchange(false, std::memory_order_relaxed);
+          });
+      INC_COUNTER("FEFC Eviction", 1, PAMM_SEVERITY_LEVEL::Full);
+    }
+    return C.Entries.insert(Key, CacheEntry<T>(std::move(Value), Method))
+        .first->Value;
+  }
+
+  // Requires the exclusive lock.
+  template <typename T, typename... Ts>
+  size_t release(Cache<T, Ts...> &C, M Method) {
+    return C.Entries.eraseIf(
+        [Method](const std::tuple<Ts...> &, const CacheEntry<T> &E) {
+          return E.Method == Method;
+        });
+  }
 
 public:
   // Ctor allows access to the IDEProblem in order to get access to flow and
   // edge function factory functions.
   FlowEdgeFunctionCache(IDETabulationProblem<N, D, M, V, I> &problem)
       : problem(problem), autoAddZero(problem.solver_config.autoAddZero),
-        zeroValue(problem.zeroValue()) {
+        zeroValue(problem.zeroValue()),
+        Concurrent(problem.solver_config.numThreads > 1),
+        Capacity(problem.solver_config.flowEdgeFunctionCacheSize),
+        TrackMethods(problem.solver_config.releaseFinishedMethods),
+        // the arena only frees its memory as a whole
+        UseArena(problem.solver_config.allocateFromArena && Capacity == 0 &&
+                 !TrackMethods) {
+    unsigned NumThreads = problem.solver_config.numThreads;
+    std::string Key = problem.getCacheKey();
+    if constexpr (std::is_reference<I>::value) {
+      if (!Key.empty()) {
+        // the functions of a problem also depend on whether zero is added
+        Key += autoAddZero ? "/zero" : "/nozero";
+        Store = CacheRegistry::getInstance().getOrCreate<Caches>(
+            &problem.interproceduralCFG(), Key,
+            [NumThreads] { return std::make_shared<Caches>(NumThreads); });
+        Concurrent = true;
+      }
+    }
+    if (!Store) {
+      Store = std::make_shared<Caches>(NumThreads);
+    }
+    if (UseArena) {
+      problem.setMemoryResource(&Store->Arena);
+    }
     PAMM_GET_INSTANCE;
+    REG_COUNTER("FEFC Eviction", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("FEFC Release", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Normal-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Normal-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
     // Counters for the call flow functions
@@ -77,8 +246,8 @@ public:
     REG_COUNTER("CallToRet-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("CallToRet-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
     // Counters for the summary flow functions
-    // REG_COUNTER("Summary-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
-    // REG_COUNTER("Summary-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Summary-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Summary-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
     // Counters for the normal edge functions
     REG_COUNTER("Normal-EF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Normal-EF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
@@ -96,7 +265,11 @@ public:
     REG_COUNTER("Summary-EF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
   }
 
-  ~FlowEdgeFunctionCache() = default;
+  ~FlowEdgeFunctionCache() {
+    if (UseArena && Store && problem.getMemoryResource() == &Store->Arena) {
+      problem.setMemoryResource(nullptr);
+    }
+  }
 
   FlowEdgeFunctionCache(const FlowEdgeFunctionCache &FEFC) = default;
 
@@ -104,170 +277,255 @@ public:
 
   std::shared_ptr<FlowFunction<D>> getNormalFlowFunction(N curr, N succ) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(curr, succ);
-    if (NormalFlowFunctionCache.count(key)) {
-      INC_COUNTER("Normal-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return NormalFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Normal-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff = (autoAddZero)
-                    ? std::make_shared<ZeroedFlowFunction<D>>(
-                          problem.getNormalFlowFunction(curr, succ), zeroValue)
-                    : problem.getNormalFlowFunction(curr, succ);
-      NormalFlowFunctionCache.insert(make_pair(key, ff));
-      return ff;
+    auto key = std::make_tuple(curr, succ);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->NormalFlowFunctionCache, key)) {
+        INC_COUNTER("Normal-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Normal-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto ff = (autoAddZero)
+                  ? makeFunction<ZeroedFlowFunction<D>>(
+                        problem.getNormalFlowFunction(curr, succ), zeroValue)
+                  : problem.getNormalFlowFunction(curr, succ);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->NormalFlowFunctionCache, key, ff, methodOf(curr));
   }
 
   std::shared_ptr<FlowFunction<D>> getCallFlowFunction(N callStmt, M destMthd) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callStmt, destMthd);
-    if (CallFlowFunctionCache.count(key)) {
-      INC_COUNTER("Call-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Call-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff =
-          (autoAddZero)
-              ? std::make_shared<ZeroedFlowFunction<D>>(
-                    problem.getCallFlowFunction(callStmt, destMthd), zeroValue)
-              : problem.getCallFlowFunction(callStmt, destMthd);
-      CallFlowFunctionCache.insert(std::make_pair(key, ff));
-      return ff;
+    auto key = std::make_tuple(callStmt, destMthd);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->CallFlowFunctionCache, key)) {
+        INC_COUNTER("Call-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Call-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto ff =
+        (autoAddZero)
+            ? makeFunction<ZeroedFlowFunction<D>>(
+                  problem.getCallFlowFunction(callStmt, destMthd), zeroValue)
+            : problem.getCallFlowFunction(callStmt, destMthd);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->CallFlowFunctionCache, key, ff, methodOf(callStmt));
   }
 
   std::shared_ptr<FlowFunction<D>> getRetFlowFunction(N callSite, M calleeMthd,
                                                       N exitStmt, N retSite) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, calleeMthd, exitStmt, retSite);
-    if (ReturnFlowFunctionCache.count(key)) {
-      INC_COUNTER("Return-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return ReturnFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Return-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff = (autoAddZero)
-                    ? std::make_shared<ZeroedFlowFunction<D>>(
-                          problem.getRetFlowFunction(callSite, calleeMthd,
-                                                     exitStmt, retSite),
-                          zeroValue)
-                    : problem.getRetFlowFunction(callSite, calleeMthd, exitStmt,
-                                                 retSite);
-      ReturnFlowFunctionCache.insert(std::make_pair(key, ff));
-      return ff;
+    auto key = std::make_tuple(callSite, calleeMthd, exitStmt, retSite);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->ReturnFlowFunctionCache, key)) {
+        INC_COUNTER("Return-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Return-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto ff = (autoAddZero)
+                  ? makeFunction<ZeroedFlowFunction<D>>(
+                        problem.getRetFlowFunction(callSite, calleeMthd,
+                                                   exitStmt, retSite),
+                        zeroValue)
+                  : problem.getRetFlowFunction(callSite, calleeMthd, exitStmt,
+                                               retSite);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->ReturnFlowFunctionCache, key, ff, calleeMthd);
   }
 
   std::shared_ptr<FlowFunction<D>>
-  getCallToRetFlowFunction(N callSite, N retSite, std::set<M> callees) {
+  getCallToRetFlowFunction(N callSite, N retSite, const std::set<M> &callees) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, retSite, callees);
-    if (CallToRetFlowFunctionCache.count(key)) {
-      INC_COUNTER("CallToRet-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallToRetFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("CallToRet-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff =
-          (autoAddZero)
-              ? std::make_shared<ZeroedFlowFunction<D>>(
-                    problem.getCallToRetFlowFunction(callSite, retSite,
-                                                     callees),
-                    zeroValue)
-              : problem.getCallToRetFlowFunction(callSite, retSite, callees);
-      CallToRetFlowFunctionCache.insert(std::make_pair(key, ff));
-      return ff;
+    auto key = std::make_tuple(callSite, retSite);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->CallToRetFlowFunctionCache, key)) {
+        INC_COUNTER("CallToRet-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("CallToRet-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto ff =
+        (autoAddZero)
+            ? makeFunction<ZeroedFlowFunction<D>>(
+                  problem.getCallToRetFlowFunction(callSite, retSite,
+                                                   callees),
+                  zeroValue)
+            : problem.getCallToRetFlowFunction(callSite, retSite, callees);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->CallToRetFlowFunctionCache, key, ff,
+                  methodOf(callSite));
   }
 
   std::shared_ptr<FlowFunction<D>> getSummaryFlowFunction(N callStmt,
                                                           M destMthd) {
-    // PAMM_GET_INSTANCE;
-    // INC_COUNTER("Summary-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    PAMM_GET_INSTANCE;
+    auto key = std::make_tuple(callStmt, destMthd);
+    {
+      auto Lock = readLock();
+      // the absence of a summary is cached as well
+      if (auto *Search = lookup(Store->SummaryFlowFunctionCache, key)) {
+        INC_COUNTER("Summary-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
+    }
+    INC_COUNTER("Summary-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
     auto ff = problem.getSummaryFlowFunction(callStmt, destMthd);
-    return ff;
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->SummaryFlowFunctionCache, key, ff,
+                  methodOf(callStmt));
   }
 
-  std::shared_ptr<EdgeFunction<V>> getNormalEdgeFunction(N curr, D currNode,
-                                                         N succ, D succNode) {
+  EdgeFunctionPtr<V> getNormalEdgeFunction(N curr, D currNode, N succ,
+                                           D succNode) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(curr, currNode, succ, succNode);
-    if (NormalEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Normal-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return NormalEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Normal-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
-      NormalEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
+    auto key = std::make_tuple(curr, currNode, succ, succNode);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->NormalEdgeFunctionCache, key)) {
+        INC_COUNTER("Normal-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Normal-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    EdgeFunctionPtr<V> ef =
+        problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->NormalEdgeFunctionCache, key, ef, methodOf(curr));
   }
 
-  std::shared_ptr<EdgeFunction<V>>
+  EdgeFunctionPtr<V>
   getCallEdgeFunction(N callStmt, D srcNode, M destinationMethod, D destNode) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callStmt, srcNode, destinationMethod, destNode);
-    if (CallEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Call-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Call-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getCallEdgeFunction(callStmt, srcNode,
-                                            destinationMethod, destNode);
-      CallEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
+    auto key = std::make_tuple(callStmt, srcNode, destinationMethod, destNode);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->CallEdgeFunctionCache, key)) {
+        INC_COUNTER("Call-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Call-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    EdgeFunctionPtr<V> ef = problem.getCallEdgeFunction(
+        callStmt, srcNode, destinationMethod, destNode);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->CallEdgeFunctionCache, key, ef, methodOf(callStmt));
   }
 
-  std::shared_ptr<EdgeFunction<V>> getReturnEdgeFunction(N callSite,
-                                                         M calleeMethod,
-                                                         N exitStmt, D exitNode,
-                                                         N reSite, D retNode) {
+  EdgeFunctionPtr<V> getReturnEdgeFunction(N callSite, M calleeMethod,
+                                           N exitStmt, D exitNode, N reSite,
+                                           D retNode) {
     PAMM_GET_INSTANCE;
-    auto key =
-        std::tie(callSite, calleeMethod, exitStmt, exitNode, reSite, retNode);
-    if (ReturnEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Return-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return ReturnEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Return-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getReturnEdgeFunction(callSite, calleeMethod, exitStmt,
-                                              exitNode, reSite, retNode);
-      ReturnEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
+    auto key = std::make_tuple(callSite, calleeMethod, exitStmt, exitNode,
+                               reSite, retNode);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->ReturnEdgeFunctionCache, key)) {
+        INC_COUNTER("Return-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Return-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    EdgeFunctionPtr<V> ef = problem.getReturnEdgeFunction(
+        callSite, calleeMethod, exitStmt, exitNode, reSite, retNode);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->ReturnEdgeFunctionCache, key, ef, calleeMethod);
   }
 
-  std::shared_ptr<EdgeFunction<V>>
+  EdgeFunctionPtr<V>
   getCallToRetEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode,
-                           std::set<M> callees) {
+                           const std::set<M> &callees) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, callNode, retSite, retSiteNode);
-    if (CallToRetEdgeFunctionCache.count(key)) {
-      INC_COUNTER("CallToRet-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallToRetEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("CallToRet-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getCallToRetEdgeFunction(callSite, callNode, retSite,
-                                                 retSiteNode, callees);
-      CallToRetEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
+    auto key = std::make_tuple(callSite, callNode, retSite, retSiteNode);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->CallToRetEdgeFunctionCache, key)) {
+        INC_COUNTER("CallToRet-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("CallToRet-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    EdgeFunctionPtr<V> ef = problem.getCallToRetEdgeFunction(
+        callSite, callNode, retSite, retSiteNode, callees);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->CallToRetEdgeFunctionCache, key, ef,
+                  methodOf(callSite));
   }
 
-  std::shared_ptr<EdgeFunction<V>>
+  EdgeFunctionPtr<V>
   getSummaryEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, callNode, retSite, retSiteNode);
-    if (SummaryEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Summary-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return SummaryEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Summary-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getSummaryEdgeFunction(callSite, callNode, retSite,
-                                               retSiteNode);
-      SummaryEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
+    auto key = std::make_tuple(callSite, callNode, retSite, retSiteNode);
+    {
+      auto Lock = readLock();
+      if (auto *Search = lookup(Store->SummaryEdgeFunctionCache, key)) {
+        INC_COUNTER("Summary-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        return *Search;
+      }
     }
+    INC_COUNTER("Summary-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    EdgeFunctionPtr<V> ef = problem.getSummaryEdgeFunction(
+        callSite, callNode, retSite, retSiteNode);
+    auto Lock = writeLock();
+    // another thread may have constructed the same function in the meantime
+    return insert(Store->SummaryEdgeFunctionCache, key, ef, methodOf(callSite));
+  }
+
+  /**
+   * Releases the cached flow and edge functions of the given method, e.g.
+   * once the solver has finished it. Released functions are reconstructed if
+   * they are needed again. Only has an effect if the cache has been created
+   * with SolverConfiguration::releaseFinishedMethods set, otherwise entries
+   * are not associated with their methods.
+   */
+  void releaseMethod(M Method) {
+    if (!TrackMethods) {
+      return;
+    }
+    PAMM_GET_INSTANCE;
+    auto Lock = writeLock();
+    [[maybe_unused]] size_t Released =
+        release(Store->NormalFlowFunctionCache, Method) +
+        release(Store->CallFlowFunctionCache, Method) +
+        release(Store->ReturnFlowFunctionCache, Method) +
+        release(Store->CallToRetFlowFunctionCache, Method) +
+        release(Store->SummaryFlowFunctionCache, Method) +
+        release(Store->NormalEdgeFunctionCache, Method) +
+        release(Store->CallEdgeFunctionCache, Method) +
+        release(Store->ReturnEdgeFunctionCache, Method) +
+        release(Store->CallToRetEdgeFunctionCache, Method) +
+        release(Store->SummaryEdgeFunctionCache, Method);
+    INC_COUNTER("FEFC Release", Released, PAMM_SEVERITY_LEVEL::Full);
+  }
+
+  /**
+   * Returns the number of cached flow and edge functions.
+   */
+  size_t size() {
+    auto Lock = readLock();
+    return Store->NormalFlowFunctionCache.Entries.size() +
+           Store->CallFlowFunctionCache.Entries.size() +
+           Store->ReturnFlowFunctionCache.Entries.size() +
+           Store->CallToRetFlowFunctionCache.Entries.size() +
+           Store->SummaryFlowFunctionCache.Entries.size() +
+           Store->NormalEdgeFunctionCache.Entries.size() +
+           Store->CallEdgeFunctionCache.Entries.size() +
+           Store->ReturnEdgeFunctionCache.Entries.size() +
+           Store->CallToRetEdgeFunctionCache.Entries.size() +
+           Store->SummaryEdgeFunctionCache.Entries.size();
   }
 
   void print() {
@@ -300,25 +558,25 @@ public:
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                     << "Call-to-Return-flow function constructions: "
                     << GET_COUNTER("CallToRet-FF Construction"));
-      // LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Summary-flow function cache
-      // hits: "
-      //                        << GET_COUNTER("Summary-FF Cache Hit"));
-      // LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Summary-flow function
-      // constructions: "
-      //                         << GET_COUNTER("Summary-FF Construction"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Summary-flow function cache hits: "
+                    << GET_COUNTER("Summary-FF Cache Hit"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Summary-flow function constructions: "
+                    << GET_COUNTER("Summary-FF Construction"));
       LOG_IF_ENABLE(
           BOOST_LOG_SEV(lg, INFO)
           << "Total flow function cache hits: "
           << GET_SUM_COUNT({"Normal-FF Cache Hit", "Call-FF Cache Hit",
-                            "Return-FF Cache Hit", "CallToRet-FF Cache Hit"}));
-      //"Summary-FF Cache Hit"});
+                            "Return-FF Cache Hit", "CallToRet-FF Cache Hit",
+                            "Summary-FF Cache Hit"}));
       LOG_IF_ENABLE(
           BOOST_LOG_SEV(lg, INFO)
           << "Total flow function constructions: "
           << GET_SUM_COUNT({"Normal-FF Construction", "Call-FF Construction",
                             "Return-FF Construction",
-                            "CallToRet-FF Construction" /*,
-                "Summary-FF Construction"*/}));
+                            "CallToRet-FF Construction",
+                            "Summary-FF Construction"}));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << " ");
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                     << "Normal edge function cache hits: "
@@ -363,6 +621,11 @@ public:
                             "Return-EF Construction",
                             "CallToRet-EF Construction",
                             "Summary-EF Construction"}));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << " ");
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Evicted cache entries: "
+                                            << GET_COUNTER("FEFC Eviction"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Released cache entries: "
+                                            << GET_COUNTER("FEFC Release"));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                     << "----------------------------------------------");
     } else {
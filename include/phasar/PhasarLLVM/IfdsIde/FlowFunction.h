@@ -17,14 +17,89 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTION_H_
 
-#include <set>
+#include <cstddef>
+#include <vector>
+
+#include <phasar/Config/ContainerConfiguration.h>
 
 namespace psr {
 
+/**
+ * Receives the targets of a batched flow-function application. The targets
+ * are stored contiguously, each source fact that has been processed owns
+ * the range of targets that has been added since the previous source fact
+ * has been finished. The targets of a source fact may contain duplicates.
+ */
+template <typename D> class TargetBuffer {
+private:
+  std::vector<D> Targets;
+  std::vector<size_t> Ends;
+
+public:
+  using const_iterator = typename std::vector<D>::const_iterator;
+
+  void add(const D &Target) { Targets.push_back(Target); }
+
+  template <typename Iterator> void add(Iterator First, Iterator Last) {
+    Targets.insert(Targets.end(), First, Last);
+  }
+
+  /**
+   * Assigns all targets added since the last call to the next source fact.
+   */
+  void endSource() { Ends.push_back(Targets.size()); }
+
+  /**
+   * Returns the number of source facts whose targets are stored.
+   */
+  size_t size() const { return Ends.size(); }
+
+  const_iterator begin(size_t Source) const {
+    return Targets.begin() + (Source == 0 ? 0 : Ends[Source - 1]);
+  }
+
+  const_iterator end(size_t Source) const {
+    return Targets.begin() + Ends[Source];
+  }
+
+  const std::vector<D> &targets() const { return Targets; }
+
+  void reserve(size_t NumSources, size_t NumTargets) {
+    Ends.reserve(Ends.size() + NumSources);
+    Targets.reserve(Targets.size() + NumTargets);
+  }
+
+  void clear() {
+    Targets.clear();
+    Ends.clear();
+  }
+};
+
 template <typename D> class FlowFunction {
 public:
+  // The targets are kept in a small inline buffer, such that the common case
+  // of few targets does not allocate. The container may hold duplicates,
+  // which the solvers ignore.
+  using container_type = FFSet<D>;
+
   virtual ~FlowFunction() = default;
-  virtual std::set<D> computeTargets(D source) = 0;
+  virtual container_type computeTargets(D source) = 0;
+
+  /**
+   * Computes the targets of all source facts at once and appends them to
+   * Targets, one source fact after the other in the order of Sources. Flow
+   * functions should override this if they can handle several facts cheaper
+   * than by a call of computeTargets() per fact.
+   */
+  virtual void computeTargetsBatch(const std::vector<D> &Sources,
+                                   TargetBuffer<D> &Targets) {
+    Targets.reserve(Sources.size(), Sources.size());
+    for (const D &Source : Sources) {
+      auto Result = computeTargets(Source);
+      Targets.add(Result.begin(), Result.end());
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
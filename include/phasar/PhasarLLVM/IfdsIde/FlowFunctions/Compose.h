@@ -17,8 +17,8 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_COMPOSE_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_COMPOSE_H_
 
+#include <algorithm>
 #include <memory>
-#include <set>
 #include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
@@ -28,33 +28,83 @@ namespace psr {
 
 template <typename D> class Compose : public FlowFunction<D> {
 protected:
-  const std::vector<FlowFunction<D>> funcs;
+  const std::vector<std::shared_ptr<FlowFunction<D>>> funcs;
 
 public:
-  Compose(const std::vector<FlowFunction<D>> &funcs) : funcs(funcs) {}
+  Compose(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs)
+      : funcs(funcs) {}
 
   virtual ~Compose() = default;
 
-  std::set<D> computeTargets(const D &source) override {
-    std::set<D> current(source);
-    for (const FlowFunction<D> &func : funcs) {
-      std::set<D> next;
+  FFSet<D> computeTargets(D source) override {
+    FFSet<D> current{source};
+    for (const auto &func : funcs) {
+      FFSet<D> next;
       for (const D &d : current) {
-        std::set<D> target = func.computeTargets(d);
-        next.insert(target.begin(), target.end());
+        for (const D &target : func->computeTargets(d)) {
+          if (std::find(next.begin(), next.end(), target) == next.end()) {
+            next.push_back(target);
+          }
+        }
       }
-      current = next;
+      current.swap(next);
     }
     return current;
   }
 
+  // applies each function once to the facts reached from all sources
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    // the facts reached so far, Reached[i] is reached from Sources[Owner[i]]
+    std::vector<D> Reached(Sources);
+    std::vector<size_t> Owner(Sources.size());
+    for (size_t Idx = 0; Idx < Owner.size(); ++Idx) {
+      Owner[Idx] = Idx;
+    }
+    TargetBuffer<D> Step;
+    for (const auto &func : funcs) {
+      Step.clear();
+      func->computeTargetsBatch(Reached, Step);
+      std::vector<D> NextReached;
+      std::vector<size_t> NextOwner;
+      NextReached.reserve(Step.targets().size());
+      NextOwner.reserve(Step.targets().size());
+      // the facts of an owner are contiguous, NextReached[OwnerBegin..] are
+      // the ones of the current owner; drop duplicates like computeTargets()
+      size_t OwnerBegin = 0;
+      for (size_t Idx = 0; Idx < Step.size(); ++Idx) {
+        if (Idx > 0 && Owner[Idx] != Owner[Idx - 1]) {
+          OwnerBegin = NextReached.size();
+        }
+        for (auto It = Step.begin(Idx); It != Step.end(Idx); ++It) {
+          if (std::find(NextReached.begin() + OwnerBegin, NextReached.end(),
+                        *It) == NextReached.end()) {
+            NextReached.push_back(*It);
+            NextOwner.push_back(Owner[Idx]);
+          }
+        }
+      }
+      Reached.swap(NextReached);
+      Owner.swap(NextOwner);
+    }
+    // Owner is sorted, since each step preserves the order of the sources
+    Targets.reserve(Sources.size(), Reached.size());
+    size_t Idx = 0;
+    for (size_t Source = 0; Source < Sources.size(); ++Source) {
+      for (; Idx < Reached.size() && Owner[Idx] == Source; ++Idx) {
+        Targets.add(Reached[Idx]);
+      }
+      Targets.endSource();
+    }
+  }
+
   static std::shared_ptr<FlowFunction<D>>
-  compose(const std::vector<FlowFunction<D>> &funcs) {
-    std::vector<FlowFunction<D>> vec;
-    for (const FlowFunction<D> &func : funcs)
+  compose(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs) {
+    std::vector<std::shared_ptr<FlowFunction<D>>> vec;
+    for (const auto &func : funcs)
       if (func != Identity<D>::getInstance())
-        vec.insert(func);
-    if (vec.size == 1)
+        vec.push_back(func);
+    if (vec.size() == 1)
       return vec[0];
     else if (vec.empty())
       return Identity<D>::getInstance();
@@ -17,7 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_GEN_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_GEN_H_
 
-#include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -31,12 +31,23 @@ protected:
 public:
   Gen(D genValue, D zeroValue) : genValue(genValue), zeroValue(zeroValue) {}
   virtual ~Gen() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == zeroValue)
       return {source, genValue};
     else
       return {source};
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size() + 1);
+    for (const D &Source : Sources) {
+      Targets.add(Source);
+      if (Source == zeroValue) {
+        Targets.add(genValue);
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
@@ -18,6 +18,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_GENALL_H_
 
 #include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -32,14 +33,28 @@ public:
   GenAll(std::set<D> genValues, D zeroValue)
       : genValues(genValues), zeroValue(zeroValue) {}
   virtual ~GenAll() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == zeroValue) {
-      genValues.insert(source);
-      return genValues;
+      FFSet<D> Targets(genValues.begin(), genValues.end());
+      if (!genValues.count(source)) {
+        Targets.push_back(source);
+      }
+      return Targets;
     } else {
       return {source};
     }
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size() + genValues.size());
+    for (const D &Source : Sources) {
+      Targets.add(Source);
+      if (Source == zeroValue) {
+        Targets.add(genValues.begin(), genValues.end());
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
@@ -11,7 +11,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_GENIF_H_
 
 #include <functional>
-#include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -31,12 +31,23 @@ public:
   GenIf(D genValue, D zeroValue, std::function<bool(D)> Predicate)
       : genValue(genValue), zeroValue(zeroValue), Predicate(Predicate) {}
   virtual ~GenIf() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (Predicate(source))
       return {source, genValue};
     else
       return {source};
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size());
+    for (const D &Source : Sources) {
+      Targets.add(Source);
+      if (Predicate(Source)) {
+        Targets.add(genValue);
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
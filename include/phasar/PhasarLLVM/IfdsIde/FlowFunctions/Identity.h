@@ -18,7 +18,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_IDENTITY_H_
 
 #include <memory>
-#include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -33,7 +33,15 @@ public:
   Identity(const Identity &i) = delete;
   Identity &operator=(const Identity &i) = delete;
   // simply return what the user provides
-  std::set<D> computeTargets(D source) override { return {source}; }
+  FFSet<D> computeTargets(D source) override { return {source}; }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size());
+    for (const D &Source : Sources) {
+      Targets.add(Source);
+      Targets.endSource();
+    }
+  }
   static std::shared_ptr<Identity> getInstance() {
     static std::shared_ptr<Identity> instance =
         std::shared_ptr<Identity>(new Identity);
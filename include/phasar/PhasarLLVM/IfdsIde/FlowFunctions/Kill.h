@@ -17,7 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_KILL_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_KILL_H_
 
-#include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -30,12 +30,22 @@ protected:
 public:
   Kill(D killValue) : killValue(killValue) {}
   virtual ~Kill() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == killValue)
       return {};
     else
       return {source};
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size());
+    for (const D &Source : Sources) {
+      if (Source != killValue) {
+        Targets.add(Source);
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
@@ -18,7 +18,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_KILLALL_H_
 
 #include <memory>
-#include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -32,7 +32,14 @@ public:
   virtual ~KillAll() = default;
   KillAll(const KillAll &k) = delete;
   KillAll &operator=(const KillAll &k) = delete;
-  std::set<D> computeTargets(D source) override { return std::set<D>(); }
+  FFSet<D> computeTargets(D source) override { return {}; }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), 0);
+    for (size_t Idx = 0; Idx < Sources.size(); ++Idx) {
+      Targets.endSource();
+    }
+  }
   static std::shared_ptr<KillAll<D>> getInstance() {
     static std::shared_ptr<KillAll> instance =
         std::shared_ptr<KillAll>(new KillAll);
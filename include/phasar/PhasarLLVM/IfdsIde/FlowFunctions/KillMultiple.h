@@ -11,6 +11,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_KILLMULTIPLE_H_
 
 #include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -23,12 +24,22 @@ protected:
 public:
   KillMultiple(std::set<D> killValues) : killValues(killValues) {}
   virtual ~KillMultiple() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (killValues.find(source) != killValues.end())
       return {};
     else
       return {source};
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size());
+    for (const D &Source : Sources) {
+      if (killValues.find(Source) == killValues.end()) {
+        Targets.add(Source);
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
@@ -12,18 +12,28 @@
 
 #include <functional>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
-#include <set>
+#include <vector>
 
 namespace psr {
 
 template <typename D> class LambdaFlow : public FlowFunction<D> {
 private:
-  std::function<std::set<D>(D)> flow;
+  std::function<FFSet<D>(D)> flow;
 
 public:
-  LambdaFlow(std::function<std::set<D>(D)> f) : flow(f) {}
+  LambdaFlow(std::function<FFSet<D>(D)> f) : flow(f) {}
   virtual ~LambdaFlow() = default;
-  std::set<D> computeTargets(D source) override { return flow(source); }
+  FFSet<D> computeTargets(D source) override { return flow(source); }
+  // saves the virtual dispatch per fact, the lambda is still called per fact
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size());
+    for (const D &Source : Sources) {
+      FFSet<D> Result = flow(Source);
+      Targets.add(Result.begin(), Result.end());
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
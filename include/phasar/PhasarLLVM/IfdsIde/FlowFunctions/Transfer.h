@@ -17,7 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_TRANSFER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_TRANSFER_H_
 
-#include <set>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
@@ -31,7 +31,7 @@ protected:
 public:
   Transfer(D toValue, D fromValue) : toValue(toValue), fromValue(fromValue) {}
   virtual ~Transfer() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == fromValue)
       return {source, toValue};
     else if (source == toValue)
@@ -39,6 +39,19 @@ public:
     else
       return {source};
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    Targets.reserve(Sources.size(), Sources.size() + 1);
+    for (const D &Source : Sources) {
+      if (Source == fromValue) {
+        Targets.add(Source);
+        Targets.add(toValue);
+      } else if (Source != toValue) {
+        Targets.add(Source);
+      }
+      Targets.endSource();
+    }
+  }
 };
 } // namespace psr
 
@@ -17,7 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_UNION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWFUNCTIONS_UNION_H_
 
-#include <set>
+#include <memory>
 #include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
@@ -27,29 +27,48 @@ namespace psr {
 
 template <typename D> class Union : public FlowFunction<D> {
 protected:
-  const std::vector<FlowFunction<D>> funcs;
+  const std::vector<std::shared_ptr<FlowFunction<D>>> funcs;
 
 public:
-  Union(const std::vector<FlowFunction<D>> &funcs) : funcs(funcs) {}
+  Union(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs)
+      : funcs(funcs) {}
   virtual ~Union() = default;
-  std::set<D> computeTargets(const D &source) override {
-    std::set<D> result;
-    for (const FlowFunction<D> &func : funcs) {
-      std::set<D> target = func.computeTarget(source);
-      result.insert(target.begin(), target.end());
+  FFSet<D> computeTargets(D source) override {
+    FFSet<D> result;
+    for (const auto &func : funcs) {
+      FFSet<D> target = func->computeTargets(source);
+      result.insert(result.end(), target.begin(), target.end());
     }
     return result;
   }
-  static FlowFunction<D> setunion(const std::vector<FlowFunction<D>> &funcs) {
-    std::vector<FlowFunction<D>> vec;
-    for (const FlowFunction<D> &func : funcs)
+  // applies each function once to all sources and merges the results
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    std::vector<TargetBuffer<D>> Results(funcs.size());
+    size_t NumTargets = 0;
+    for (size_t Idx = 0; Idx < funcs.size(); ++Idx) {
+      funcs[Idx]->computeTargetsBatch(Sources, Results[Idx]);
+      NumTargets += Results[Idx].targets().size();
+    }
+    Targets.reserve(Sources.size(), NumTargets);
+    for (size_t Source = 0; Source < Sources.size(); ++Source) {
+      for (const auto &Result : Results) {
+        Targets.add(Result.begin(Source), Result.end(Source));
+      }
+      Targets.endSource();
+    }
+  }
+  static std::shared_ptr<FlowFunction<D>>
+  setunion(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs) {
+    std::vector<std::shared_ptr<FlowFunction<D>>> vec;
+    for (const auto &func : funcs)
       if (func != Identity<D>::getInstance())
-        vec.add(func);
+        vec.push_back(func);
     if (vec.size() == 1)
       return vec[0];
     else if (vec.empty())
       return Identity<D>::getInstance();
-    return Union(vec);
+    return std::make_shared<Union>(vec);
   }
 };
 } // namespace psr
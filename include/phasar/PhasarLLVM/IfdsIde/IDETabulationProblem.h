@@ -18,6 +18,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_IDETABULATIONPROBLEM_H_
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions.h>
@@ -34,6 +35,26 @@ class IDETabulationProblem : public virtual IFDSTabulationProblem<N, D, M, I>,
 public:
   virtual ~IDETabulationProblem() = default;
   virtual std::shared_ptr<EdgeFunction<V>> allTopFunction() = 0;
+  /**
+   * Converts value v and edge function f into strings and back, such that
+   * the solver can be checkpointed together with the nodes and data-flow
+   * facts, see IFDSTabulationProblem::NtoPersistedString(). The defaults do
+   * not support checkpoints.
+   */
+  virtual std::string VtoPersistedString(V v) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
+  virtual V persistedStringToV(const std::string &s) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
+  virtual std::string
+  edgeFunctionToPersistedString(std::shared_ptr<EdgeFunction<V>> f) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
+  virtual std::shared_ptr<EdgeFunction<V>>
+  persistedStringToEdgeFunction(const std::string &s) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
   virtual void printIDEReport(std::ostream &os, SolverResults<N, D, V> &SR) {
     os << "No IDE report available!\n";
   }
@@ -37,10 +37,10 @@ public:
       : StartNode(Start), EndNode(End), Context(C), Outputs(Gen),
         ZeroValue(ZV) {}
   virtual ~IFDSSummary() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == ZeroValue) {
       Outputs.insert(source);
-      return Outputs;
+      return FFSet<D>(Outputs.begin(), Outputs.end());
     } else {
       return {source};
     }
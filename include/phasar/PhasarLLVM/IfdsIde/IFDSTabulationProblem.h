@@ -18,13 +18,17 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_IFDSTABULATIONPROBLEM_H_
 
 #include <map>
+#include <memory>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/SolverResults.h>
 #include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
 #include <phasar/PhasarLLVM/Utils/Printer.h>
+#include <phasar/Utils/ArenaAllocator.h>
 
 namespace psr {
 
@@ -44,10 +48,83 @@ public:
     solver_config = conf;
   }
   SolverConfiguration getSolverConfiguration() { return solver_config; }
+  /**
+   * Returns a key that identifies the flow and edge functions of this
+   * problem. Solvers for problems with the same non-empty key on the same
+   * interprocedural CFG share their flow and edge function caches, e.g. if
+   * a problem is solved repeatedly with different seeds. A problem may only
+   * report a key if its functions neither refer to the problem instance nor
+   * to its mutable state. The default empty key disables sharing.
+   */
+  virtual std::string getCacheKey() const { return ""; }
+  /**
+   * Is queried by the solver whenever it has processed a path edge along
+   * which fact d reaches node n. Returning true stops the solver right away:
+   * the construction of the exploded super graph is aborted and no values
+   * are computed, hence the solver's results are incomplete. Problems can
+   * use this to stop as soon as they have found what they are looking for.
+   * The default never terminates early.
+   */
+  virtual bool shouldTerminate(N n, D d) { return false; }
+  /**
+   * Is queried by the solver if SolverConfiguration::sparsePropagation is
+   * enabled. Returning false promises that the normal flow function of node
+   * n maps fact d to itself only, using the identity edge function, and that
+   * its construction has no side effects. The solver then propagates d past
+   * n without evaluating the flow and edge functions of n. Call sites and
+   * exit nodes are never skipped. The default may affect every fact.
+   */
+  virtual bool mayAffect(N n, D d) { return true; }
+  /**
+   * Converts node n into a string that identifies it in every run on the
+   * same program, and back. Used to checkpoint the solver, see
+   * SolverConfiguration::checkpointFile. The default does not support
+   * checkpoints.
+   */
+  virtual std::string NtoPersistedString(N n) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
+  virtual N persistedStringToN(const std::string &s) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
+  /**
+   * Same as NtoPersistedString() and persistedStringToN(), but for
+   * data-flow facts.
+   */
+  virtual std::string DtoPersistedString(D d) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
+  virtual D persistedStringToD(const std::string &s) {
+    throw std::runtime_error("problem does not support checkpoints");
+  }
   virtual void printIFDSReport(std::ostream &os,
                                SolverResults<N, D, BinaryDomain> &SR) {
     os << "No IFDS report available!\n";
   }
+  /**
+   * Sets the arena that makeFunction() allocates from. Is called by the
+   * solver if SolverConfiguration::allocateFromArena is enabled, and reset
+   * to nullptr, i.e. the global heap, once the solver's caches are released.
+   */
+  virtual void setMemoryResource(MonotonicArena *MR) { MemoryResource = MR; }
+  MonotonicArena *getMemoryResource() const { return MemoryResource; }
+
+protected:
+  MonotonicArena *MemoryResource = nullptr;
+
+  /**
+   * Like std::make_shared, but allocates from the arena provided by the
+   * solver, if any. Functions created this way must not be kept beyond the
+   * lifetime of the solver's flow and edge function caches.
+   */
+  template <typename T, typename... ArgTs>
+  std::shared_ptr<T> makeFunction(ArgTs &&... Args) {
+    if (MemoryResource) {
+      return std::allocate_shared<T>(ArenaAllocator<T>(MemoryResource),
+                                     std::forward<ArgTs>(Args)...);
+    }
+    return std::make_shared<T>(std::forward<ArgTs>(Args)...);
+  }
 };
 } // namespace psr
 
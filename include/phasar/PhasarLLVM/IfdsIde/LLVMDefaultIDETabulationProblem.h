@@ -17,6 +17,11 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_LLVMDEFAULTIDETABULATIONPROBLEM_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_LLVMDEFAULTIDETABULATIONPROBLEM_H_
 
+#include <string>
+#include <type_traits>
+
+#include <llvm/Support/Casting.h>
+
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/PhasarLLVM/IfdsIde/DefaultIDETabulationProblem.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
@@ -39,6 +44,35 @@ public:
         th(th), irdb(irdb) {}
 
   virtual ~LLVMDefaultIDETabulationProblem() = default;
+
+  std::string NtoPersistedString(const llvm::Instruction *n) override {
+    return irdb.valueToPersistedString(n);
+  }
+
+  const llvm::Instruction *persistedStringToN(const std::string &s) override {
+    return llvm::cast<llvm::Instruction>(irdb.persistedStringToValue(s));
+  }
+
+  // facts that are LLVM values are persisted like the nodes
+  std::string DtoPersistedString(D d) override {
+    if constexpr (std::is_same<D, const llvm::Value *>::value) {
+      return irdb.valueToPersistedString(d);
+    } else {
+      return IFDSTabulationProblem<const llvm::Instruction *, D,
+                                   const llvm::Function *,
+                                   I>::DtoPersistedString(d);
+    }
+  }
+
+  D persistedStringToD(const std::string &s) override {
+    if constexpr (std::is_same<D, const llvm::Value *>::value) {
+      return irdb.persistedStringToValue(s);
+    } else {
+      return IFDSTabulationProblem<const llvm::Instruction *, D,
+                                   const llvm::Function *,
+                                   I>::persistedStringToD(s);
+    }
+  }
 };
 
 } // namespace psr
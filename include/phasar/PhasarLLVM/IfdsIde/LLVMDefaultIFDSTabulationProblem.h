@@ -18,6 +18,10 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_LLVMDEFAULTIFDSTABULATIONPROBLEM_H_
 
 #include <memory>
+#include <string>
+#include <type_traits>
+
+#include <llvm/Support/Casting.h>
 
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/PhasarLLVM/IfdsIde/DefaultIFDSTabulationProblem.h>
@@ -42,6 +46,35 @@ public:
         th(th), irdb(irdb) {}
 
   virtual ~LLVMDefaultIFDSTabulationProblem() = default;
+
+  std::string NtoPersistedString(const llvm::Instruction *n) override {
+    return irdb.valueToPersistedString(n);
+  }
+
+  const llvm::Instruction *persistedStringToN(const std::string &s) override {
+    return llvm::cast<llvm::Instruction>(irdb.persistedStringToValue(s));
+  }
+
+  // facts that are LLVM values are persisted like the nodes
+  std::string DtoPersistedString(D d) override {
+    if constexpr (std::is_same<D, const llvm::Value *>::value) {
+      return irdb.valueToPersistedString(d);
+    } else {
+      return IFDSTabulationProblem<const llvm::Instruction *, D,
+                                   const llvm::Function *,
+                                   I>::DtoPersistedString(d);
+    }
+  }
+
+  D persistedStringToD(const std::string &s) override {
+    if constexpr (std::is_same<D, const llvm::Value *>::value) {
+      return irdb.persistedStringToValue(s);
+    } else {
+      return IFDSTabulationProblem<const llvm::Instruction *, D,
+                                   const llvm::Function *,
+                                   I>::persistedStringToD(s);
+    }
+  }
 };
 
 } // namespace psr
@@ -42,7 +42,7 @@ public:
                const llvm::Instruction *in);
   virtual ~AutoKillTMPs() = default;
 
-  std::set<const llvm::Value *>
+  FFSet<const llvm::Value *>
   computeTargets(const llvm::Value *source) override;
 };
 
@@ -33,6 +33,8 @@ protected:
   const llvm::Function *destMthd;
   std::vector<const llvm::Value *> actuals;
   std::vector<const llvm::Value *> formals;
+  // allocations of %struct.__va_list_tag in a variadic destMthd
+  std::vector<const llvm::Value *> vaListAllocs;
   std::function<bool(const llvm::Value *)> predicate;
 
 public:
@@ -42,8 +44,11 @@ public:
           [](const llvm::Value *) { return true; });
   virtual ~MapFactsToCallee() = default;
 
-  std::set<const llvm::Value *>
+  FFSet<const llvm::Value *>
   computeTargets(const llvm::Value *source) override;
+
+  void computeTargetsBatch(const std::vector<const llvm::Value *> &Sources,
+                           TargetBuffer<const llvm::Value *> &Targets) override;
 };
 
 } // namespace psr
@@ -40,6 +40,8 @@ private:
   const llvm::ReturnInst *exitStmt;
   std::vector<const llvm::Value *> actuals;
   std::vector<const llvm::Value *> formals;
+  // allocation of %struct.__va_list_tag in a variadic calleeMthd
+  const llvm::Value *vaListAlloc = nullptr;
   std::function<bool(const llvm::Value *)> paramPredicate;
   std::function<bool(const llvm::Function *)> returnPredicate;
 
@@ -53,7 +55,11 @@ public:
           [](const llvm::Function *) { return true; });
   virtual ~MapFactsToCaller() = default;
 
-  std::set<const llvm::Value *> computeTargets(const llvm::Value *source);
+  FFSet<const llvm::Value *>
+  computeTargets(const llvm::Value *source) override;
+
+  void computeTargetsBatch(const std::vector<const llvm::Value *> &Sources,
+                           TargetBuffer<const llvm::Value *> &Targets) override;
 };
 
 } // namespace psr
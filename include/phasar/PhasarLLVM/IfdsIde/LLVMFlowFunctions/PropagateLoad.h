@@ -10,6 +10,8 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_LLVMFLOWFUNCTIONS_PROPAGATELOAD_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_LLVMFLOWFUNCTIONS_PROPAGATELOAD_H_
 
+#include <vector>
+
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
 #include <llvm/IR/Instructions.h>
@@ -24,12 +26,25 @@ public:
   PropagateLoad(const llvm::LoadInst *L) : Load(L) {}
   virtual ~PropagateLoad() = default;
 
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == Load->getPointerOperand()) {
       return {source, Load};
     }
     return {source};
   }
+
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    const llvm::Value *PointerOp = Load->getPointerOperand();
+    Targets.reserve(Sources.size(), Sources.size() + 1);
+    for (const D &Source : Sources) {
+      Targets.add(Source);
+      if (Source == PointerOp) {
+        Targets.add(Load);
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
@@ -10,6 +10,8 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_LLVMFLOWFUNCTIONS_PROPAGATESTORE_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_LLVMFLOWFUNCTIONS_PROPAGATESTORE_H_
 
+#include <vector>
+
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 
 #include <llvm/IR/Instructions.h>
@@ -24,12 +26,25 @@ public:
   PropagateStore(const llvm::StoreInst *S) : Store(S) {}
   virtual ~PropagateStore() = default;
 
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (Store->getValueOperand() == source) {
       return {source, Store->getPointerOperand()};
     }
     return {source};
   }
+
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    const llvm::Value *ValueOp = Store->getValueOperand();
+    Targets.reserve(Sources.size(), Sources.size() + 1);
+    for (const D &Source : Sources) {
+      Targets.add(Source);
+      if (Source == ValueOp) {
+        Targets.add(Store->getPointerOperand());
+      }
+      Targets.endSource();
+    }
+  }
 };
 
 } // namespace psr
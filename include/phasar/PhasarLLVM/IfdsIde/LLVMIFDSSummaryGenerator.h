@@ -71,12 +71,13 @@ private:
 
 public:
   LLVMIFDSSummaryGenerator(const llvm::Function *F, I icfg,
-                           SummaryGenerationStrategy S)
+                           SummaryGenerationStrategy S,
+                           unsigned NumThreads = 1)
       : IFDSSummaryGenerator<const llvm::Instruction *, const llvm::Value *,
                              const llvm::Function *, I,
                              ConcreteIFDSTabulationProblem,
-                             LLVMIFDSSolver<const llvm::Value *, I>>(F, icfg,
-                                                                     S) {}
+                             LLVMIFDSSolver<const llvm::Value *, I>>(
+            F, icfg, S, NumThreads) {}
 
   virtual ~LLVMIFDSSummaryGenerator() = default;
 };
@@ -36,8 +36,6 @@ private:
   std::vector<std::string> EntryPoints;
 
   // For debug purpose only
-  static unsigned CurrGenConstant_Id;
-  static unsigned CurrLCAID_Id;
   static unsigned CurrBinary_Id;
 
 public:
@@ -83,6 +81,8 @@ public:
 
   bool isZeroValue(d_t d) const override;
 
+  std::string getCacheKey() const override;
+
   // in addition provide specifications for the IDE parts
 
   std::shared_ptr<EdgeFunction<v_t>>
@@ -116,6 +116,8 @@ public:
 
   // Custom EdgeFunction declarations
 
+  // Composes edge functions of which at least one is not linear, i.e. a
+  // division or remainder of a value
   class LCAEdgeFunctionComposer : public EdgeFunctionComposer<v_t> {
   public:
     LCAEdgeFunctionComposer(std::shared_ptr<EdgeFunction<v_t>> F,
@@ -129,35 +131,34 @@ public:
     joinWith(std::shared_ptr<EdgeFunction<v_t>> otherFunction) override;
   };
 
-  class GenConstant : public EdgeFunction<v_t>,
-                      public std::enable_shared_from_this<GenConstant> {
+  /**
+   * The edge function x -> Factor * x + Summand, which represents constants
+   * (Factor is zero) as well as the additions, subtractions and
+   * multiplications of a value and a constant, and every composition of
+   * them. Hence, chains of such operations, e.g. along loops and call
+   * chains, are kept in this normal form, and their compositions, joins and
+   * comparisons take constant time. The top and bottom values are mapped to
+   * themselves unless the function is constant.
+   */
+  class LinearEdgeFunction
+      : public EdgeFunction<v_t>,
+        public std::enable_shared_from_this<LinearEdgeFunction> {
   private:
-    const unsigned GenConstant_Id;
-    const v_t IntConst;
+    const v_t Factor;
+    const v_t Summand;
 
   public:
-    explicit GenConstant(v_t IntConst);
-
-    v_t computeTarget(v_t source) override;
-
-    std::shared_ptr<EdgeFunction<v_t>>
-    composeWith(std::shared_ptr<EdgeFunction<v_t>> secondFunction) override;
-
-    std::shared_ptr<EdgeFunction<v_t>>
-    joinWith(std::shared_ptr<EdgeFunction<v_t>> otherFunction) override;
+    LinearEdgeFunction(v_t Factor, v_t Summand);
 
-    bool equal_to(std::shared_ptr<EdgeFunction<v_t>> other) const override;
+    /**
+     * Returns the function x -> Factor * x + Summand, which is the
+     * EdgeIdentity if Factor is one and Summand is zero.
+     */
+    static std::shared_ptr<EdgeFunction<v_t>> create(v_t Factor, v_t Summand);
 
-    void print(std::ostream &OS, bool isForDebug = false) const override;
-  };
+    v_t getFactor() const { return Factor; }
 
-  class LCAIdentity : public EdgeFunction<v_t>,
-                      public std::enable_shared_from_this<LCAIdentity> {
-  private:
-    const unsigned LCAID_Id;
-
-  public:
-    explicit LCAIdentity();
+    v_t getSummand() const { return Summand; }
 
     v_t computeTarget(v_t source) override;
 
@@ -169,6 +170,8 @@ public:
 
     bool equal_to(std::shared_ptr<EdgeFunction<v_t>> other) const override;
 
+    size_t hash() const override;
+
     void print(std::ostream &OS, bool isForDebug = false) const override;
   };
 
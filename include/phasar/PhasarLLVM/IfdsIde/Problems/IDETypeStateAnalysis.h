@@ -16,11 +16,13 @@
 #include <set>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionComposer.h>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMDefaultIDETabulationProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/TypeStateDescription.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/TypeStateTransitionTable.h>
 
 namespace llvm {
 class Instruction;
@@ -43,6 +45,7 @@ public:
 
 private:
   const TypeStateDescription &TSD;
+  const TypeStateTransitionTable TSTable;
   std::vector<std::string> EntryPoints;
   std::map<const llvm::Value *, std::set<const llvm::Value *>> PointsToCache;
   std::map<const llvm::Value *, std::set<const llvm::Value *>>
@@ -171,7 +174,8 @@ public:
   void printIDEReport(std::ostream &os,
                       SolverResults<n_t, d_t, v_t> &SR) override;
 
-  // customize the edge function composer
+  // customize the edge function composer, which is only needed if a
+  // TSEdgeFunction is composed with a function of another kind
   class TSEdgeFunctionComposer : public EdgeFunctionComposer<v_t> {
   private:
     v_t botElement;
@@ -184,18 +188,49 @@ public:
     joinWith(std::shared_ptr<EdgeFunction<v_t>> otherFunction) override;
   };
 
+  /**
+   * Maps every state of the finite state machine to a state. The map is
+   * stored as an array over the dense state indices of the transition table,
+   * hence composing and joining two such functions takes O(#states) and
+   * yields a TSEdgeFunction again.
+   */
   class TSEdgeFunction : public EdgeFunction<v_t>,
                          public std::enable_shared_from_this<TSEdgeFunction> {
-  protected:
-    const TypeStateDescription &TSD;
-    // Do not use a reference here, since LLVM's StringRef's (obtained by str())
-    // might turn to nullptr for whatever reason...
-    const std::string Token;
-    v_t CurrentState;
+  public:
+    using StateIdx = TypeStateTransitionTable::StateIdx;
+
+  private:
+    const TypeStateTransitionTable &Table;
+    // Mapping[S] = target state index for the source state index S
+    const std::vector<StateIdx> Mapping;
 
   public:
-    TSEdgeFunction(const TypeStateDescription &tsd, const std::string tok)
-        : TSD(tsd), Token(tok), CurrentState(TSD.top()){};
+    TSEdgeFunction(const TypeStateTransitionTable &Table,
+                   std::vector<StateIdx> Mapping)
+        : Table(Table), Mapping(std::move(Mapping)){};
+
+    /**
+     * Returns EdgeIdentity if Mapping maps every state to itself and a
+     * TSEdgeFunction otherwise.
+     */
+    static std::shared_ptr<EdgeFunction<v_t>>
+    create(const TypeStateTransitionTable &Table,
+           std::vector<StateIdx> Mapping);
+
+    /**
+     * Returns the state transition caused by a call to the api function F.
+     */
+    static std::shared_ptr<EdgeFunction<v_t>>
+    createTransition(const TypeStateTransitionTable &Table,
+                     TypeStateTransitionTable::FunctionId F);
+
+    /**
+     * Returns the function that maps every state to S.
+     */
+    static std::shared_ptr<EdgeFunction<v_t>>
+    createConstant(const TypeStateTransitionTable &Table, v_t S);
+
+    const std::vector<StateIdx> &getMapping() const { return Mapping; }
 
     v_t computeTarget(v_t source) override;
 
@@ -207,6 +242,8 @@ public:
 
     bool equal_to(std::shared_ptr<EdgeFunction<v_t>> other) const override;
 
+    size_t hash() const override;
+
     void print(std::ostream &OS, bool isForDebug = false) const override;
   };
 };
@@ -152,6 +152,12 @@ public:
    */
   std::map<n_t, std::set<d_t>> initialSeeds() override;
 
+  /**
+   * Only store instructions may affect a data-flow fact. Since their flow
+   * functions update the Initialized set, they are never skipped.
+   */
+  bool mayAffect(n_t n, d_t d) override;
+
   /**
    * @brief Returns appropriate zero value.
    */
@@ -56,6 +56,10 @@ public:
   /// Holds all leaks found during the analysis
   std::map<n_t, std::set<d_t>> Leaks;
 
+  /// Stops the analysis as soon as leaks at this many sink calls have been
+  /// found, zero runs the analysis to completion
+  size_t MaxLeaks = 0;
+
   /**
    *
    * @param icfg
@@ -88,6 +92,10 @@ public:
 
   std::map<n_t, std::set<d_t>> initialSeeds() override;
 
+  bool shouldTerminate(n_t n, d_t d) override;
+
+  bool mayAffect(n_t n, d_t d) override;
+
   d_t createZeroValue() override;
 
   bool isZeroValue(d_t d) const override;
@@ -66,6 +66,8 @@ public:
 
   std::map<n_t, std::set<d_t>> initialSeeds() override;
 
+  bool mayAffect(n_t n, d_t d) override;
+
   d_t createZeroValue() override;
 
   bool isZeroValue(d_t d) const override;
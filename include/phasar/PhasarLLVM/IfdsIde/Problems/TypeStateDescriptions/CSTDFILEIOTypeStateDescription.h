@@ -10,9 +10,10 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_TYPESTATEDESCRIPTIONS_CSTDFILEIOTYPESTATEDESCRIPTION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_TYPESTATEDESCRIPTIONS_CSTDFILEIOTYPESTATEDESCRIPTION_H_
 
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/TypeStateDescription.h>
 
@@ -49,7 +50,7 @@ private:
    */
   enum class CSTDFILEIOToken { FOPEN = 0, FCLOSE = 1, STAR = 2 };
 
-  static const std::map<std::string, std::set<int>> StdFileIOFuncs;
+  static const std::unordered_map<std::string, std::set<int>> StdFileIOFuncs;
   // delta matrix to implement the state machine's delta function
   static const CSTDFILEIOState delta[3][4];
   CSTDFILEIOToken funcNameToToken(const std::string &F) const;
@@ -58,6 +59,8 @@ public:
   bool isFactoryFunction(const std::string &F) const override;
   bool isConsumingFunction(const std::string &F) const override;
   bool isAPIFunction(const std::string &F) const override;
+  std::vector<std::string> getAPIFunctions() const override;
+  std::vector<TypeStateDescription::State> getStates() const override;
   TypeStateDescription::State
   getNextState(std::string Tok, TypeStateDescription::State S) const override;
   std::string getTypeNameOfInterest() const override;
@@ -12,6 +12,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 namespace psr {
 
@@ -27,6 +28,9 @@ namespace psr {
  * introduces dependencies that cannot be solved by a distributive framework
  * such as IDE.
  *
+ * The IDETypeStateAnalysis does not query the finite state machine while
+ * solving, but compiles it into a TypeStateTransitionTable beforehand.
+ *
  * @see CSTDFILEIOTypeStateDescription as an example of type state description.
  */
 struct TypeStateDescription {
@@ -37,6 +41,16 @@ struct TypeStateDescription {
   virtual bool isConsumingFunction(const std::string &F) const = 0;
   virtual bool isAPIFunction(const std::string &F) const = 0;
 
+  /**
+   * Returns the names of all functions of the analyzed api.
+   */
+  virtual std::vector<std::string> getAPIFunctions() const = 0;
+
+  /**
+   * Returns all states of the finite state machine besides bottom and top.
+   */
+  virtual std::vector<State> getStates() const = 0;
+
   /**
    * @brief For a given function name (as a string token) and a state, this
    * function returns the next state.
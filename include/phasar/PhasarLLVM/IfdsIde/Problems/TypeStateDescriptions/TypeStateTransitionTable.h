@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright (c) 2018 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_TYPESTATEDESCRIPTIONS_TYPESTATETRANSITIONTABLE_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_TYPESTATEDESCRIPTIONS_TYPESTATETRANSITIONTABLE_H_
+
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/TypeStateDescription.h>
+#include <phasar/Utils/Interner.h>
+
+namespace psr {
+
+/**
+ * The finite state machine of a TypeStateDescription compiled into dense
+ * tables. The states, including top and bottom, are numbered by dense
+ * indices and the api functions are interned to dense function ids. The
+ * next state for a function and a state as well as the join of two states
+ * are then a single table lookup each, no matter how expensive the
+ * corresponding queries to the description are.
+ *
+ * Top is mapped to top and bottom to bottom by every function, such that the
+ * transitions are strict with respect to the lattice.
+ */
+class TypeStateTransitionTable {
+public:
+  using State = TypeStateDescription::State;
+  using StateIdx = uint8_t;
+  using FunctionId = Interner<std::string>::Id;
+
+private:
+  const TypeStateDescription &TSD;
+  Interner<std::string> Functions;
+  std::vector<State> States;
+  std::unordered_map<State, StateIdx> StateIndices;
+  // Delta[F * NumStates + S] = next state of S after calling F
+  std::vector<StateIdx> Delta;
+  // Joins[S1 * NumStates + S2] = join of S1 and S2
+  std::vector<StateIdx> Joins;
+
+public:
+  static constexpr StateIdx TopIdx = 0;
+  static constexpr StateIdx BottomIdx = 1;
+
+  TypeStateTransitionTable(const TypeStateDescription &TSD);
+
+  ~TypeStateTransitionTable() = default;
+
+  TypeStateTransitionTable(const TypeStateTransitionTable &) = delete;
+
+  TypeStateTransitionTable &
+  operator=(const TypeStateTransitionTable &) = delete;
+
+  const TypeStateDescription &getDescription() const { return TSD; }
+
+  /**
+   * Returns the id of the api function F, std::nullopt if F is not part of
+   * the api.
+   */
+  std::optional<FunctionId> getFunctionId(const std::string &F) const {
+    return Functions.findId(F);
+  }
+
+  std::string getFunctionName(FunctionId F) const { return Functions.get(F); }
+
+  size_t getNumFunctions() const { return Functions.size(); }
+
+  size_t getNumStates() const { return States.size(); }
+
+  StateIdx getStateIdx(State S) const {
+    auto Search = StateIndices.find(S);
+    assert(Search != StateIndices.end() && "unknown state");
+    return Search->second;
+  }
+
+  State getState(StateIdx S) const {
+    assert(S < States.size() && "unknown state index");
+    return States[S];
+  }
+
+  StateIdx getNextState(FunctionId F, StateIdx S) const {
+    return Delta[F * States.size() + S];
+  }
+
+  StateIdx join(StateIdx S1, StateIdx S2) const {
+    return Joins[S1 * States.size() + S2];
+  }
+};
+
+} // namespace psr
+
+#endif
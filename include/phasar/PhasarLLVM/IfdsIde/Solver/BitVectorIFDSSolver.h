@@ -0,0 +1,493 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BITVECTORIFDSSOLVER_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BITVECTORIFDSSOLVER_H_
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <phasar/PhasarLLVM/Utils/BinaryDomain.h>
+#include <phasar/Utils/Interner.h>
+#include <phasar/Utils/Logger.h>
+#include <phasar/Utils/PAMMMacros.h>
+
+namespace psr {
+
+/**
+ * Solves an IFDS problem without going through the IDE machinery.
+ *
+ * The data-flow facts are mapped to dense ids and the path edges that start
+ * in a fact d1 at the start point of a method and reach a node n are stored
+ * as a single bit vector over the facts holding at n. Edge functions are not
+ * involved at all. Instead of single path edges, the solver propagates the
+ * newly reached bits of a (n, d1) pair at once, such that merging and
+ * comparing fact sets boil down to word-wise bit operations.
+ *
+ * The problem's flow functions are applied once per edge and fact and their
+ * targets are cached as bit vectors; a flow function applied to a set of
+ * facts is the union of the cached rows. The facts reaching a node that a
+ * flow function has not seen yet are passed to computeTargetsBatch() at
+ * once. This requires computeTargets() to
+ * only depend on its argument, which holds for gen/kill-style functions.
+ * Since IFDS problems do not expose a fixed fact domain, the bit vectors grow
+ * as new facts are discovered.
+ *
+ * The results are the same as the ones of IFDSSolver and can be queried
+ * using resultsAt() and ifdsResultsAt().
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used.
+ */
+template <typename N, typename D, typename M, typename I>
+class BitVectorIFDSSolver {
+public:
+  using FactSet = boost::dynamic_bitset<uint64_t>;
+
+private:
+  using Id = typename Interner<D>::Id;
+
+  // A flow function together with its targets for the facts it has already
+  // been applied to.
+  struct Transfer {
+    std::shared_ptr<FlowFunction<D>> Function;
+    std::unordered_map<Id, FactSet> Targets;
+  };
+
+  IFDSTabulationProblem<N, D, M, I> &ifdsProblem;
+  I icfg;
+  D zeroValue;
+  bool autoAddZero;
+  bool followReturnsPastSeeds;
+  std::map<N, std::set<D>> initialSeeds;
+
+  Interner<N> NodeIds;
+  Interner<D> FactIds;
+
+  // (n, d1) -> facts d2 such that the path edge <sP, d1> -> <n, d2> exists
+  std::unordered_map<uint64_t, FactSet> PathEdges;
+  // n -> facts d2 that hold at n under any source fact
+  std::unordered_map<Id, FactSet> Reached;
+  // (n, d1) -> facts that have been added to the path edges but have not
+  // been processed yet; a pair is pending iff it has an entry
+  std::unordered_map<uint64_t, FactSet> Delta;
+  std::deque<uint64_t> WorkList;
+  bool TerminatedEarly = false;
+
+  // (sP, d3) -> call node c -> caller-side source facts d1 such that <c, d2>
+  // flows into <sP, d3> for some d2 with <sP_c, d1> -> <c, d2>
+  std::unordered_map<uint64_t, std::unordered_map<Id, FactSet>> Incoming;
+  // (sP, d1) -> exit node eP -> facts d2 such that <sP, d1> -> <eP, d2>
+  std::unordered_map<uint64_t, std::unordered_map<Id, FactSet>> EndSummaries;
+
+  std::map<std::tuple<N, N>, Transfer> NormalTransfers;
+  std::map<std::tuple<N, M>, Transfer> CallTransfers;
+  std::map<std::tuple<N, M, N, N>, Transfer> ReturnTransfers;
+  std::map<std::tuple<N, N>, Transfer> CallToReturnTransfers;
+  std::map<std::tuple<N, M>, Transfer> SummaryTransfers;
+  // scratch space for the batched application of flow functions
+  std::vector<D> BatchSources;
+  std::vector<Id> BatchIds;
+  TargetBuffer<D> Batch;
+
+  std::shared_ptr<FlowFunction<D>>
+  zeroed(std::shared_ptr<FlowFunction<D>> Function) {
+    if (autoAddZero && Function) {
+      return std::make_shared<ZeroedFlowFunction<D>>(Function, zeroValue);
+    }
+    return Function;
+  }
+
+  Transfer &getNormalTransfer(N Curr, N Succ) {
+    auto Key = std::make_tuple(Curr, Succ);
+    auto Search = NormalTransfers.find(Key);
+    if (Search != NormalTransfers.end()) {
+      return Search->second;
+    }
+    return NormalTransfers[Key] = Transfer{
+               zeroed(ifdsProblem.getNormalFlowFunction(Curr, Succ)), {}};
+  }
+
+  Transfer &getCallTransfer(N CallStmt, M Callee) {
+    auto Key = std::make_tuple(CallStmt, Callee);
+    auto Search = CallTransfers.find(Key);
+    if (Search != CallTransfers.end()) {
+      return Search->second;
+    }
+    return CallTransfers[Key] = Transfer{
+               zeroed(ifdsProblem.getCallFlowFunction(CallStmt, Callee)), {}};
+  }
+
+  Transfer &getReturnTransfer(N CallSite, M Callee, N ExitStmt, N RetSite) {
+    auto Key = std::make_tuple(CallSite, Callee, ExitStmt, RetSite);
+    auto Search = ReturnTransfers.find(Key);
+    if (Search != ReturnTransfers.end()) {
+      return Search->second;
+    }
+    return ReturnTransfers[Key] =
+               Transfer{zeroed(ifdsProblem.getRetFlowFunction(
+                            CallSite, Callee, ExitStmt, RetSite)),
+                        {}};
+  }
+
+  Transfer &getCallToReturnTransfer(N CallSite, N RetSite,
+                                    const std::set<M> &Callees) {
+    auto Key = std::make_tuple(CallSite, RetSite);
+    auto Search = CallToReturnTransfers.find(Key);
+    if (Search != CallToReturnTransfers.end()) {
+      return Search->second;
+    }
+    return CallToReturnTransfers[Key] =
+               Transfer{zeroed(ifdsProblem.getCallToRetFlowFunction(
+                            CallSite, RetSite, Callees)),
+                        {}};
+  }
+
+  // Contrary to the other flow functions, the special summary may be null
+  // and is used as is, like in IDESolver.
+  Transfer &getSummaryTransfer(N CallStmt, M Callee) {
+    auto Key = std::make_tuple(CallStmt, Callee);
+    auto Search = SummaryTransfers.find(Key);
+    if (Search != SummaryTransfers.end()) {
+      return Search->second;
+    }
+    return SummaryTransfers[Key] =
+               Transfer{ifdsProblem.getSummaryFlowFunction(CallStmt, Callee),
+                        {}};
+  }
+
+  // Grows S such that it covers all facts discovered so far.
+  FactSet &fit(FactSet &S) {
+    if (S.size() < FactIds.size()) {
+      S.resize(FactIds.size());
+    }
+    return S;
+  }
+
+  // Adds the facts in From to Into, which may have been fit at different
+  // points in time.
+  void unite(FactSet &Into, const FactSet &From) {
+    fit(Into);
+    if (From.size() == Into.size()) {
+      Into |= From;
+      return;
+    }
+    for (auto Fact = From.find_first(); Fact != FactSet::npos;
+         Fact = From.find_next(Fact)) {
+      Into.set(Fact);
+    }
+  }
+
+  FactSet singleton(Id Fact) {
+    FactSet S(FactIds.size());
+    S.set(Fact);
+    return S;
+  }
+
+  // Returns the union of the targets of T's function for all facts in Facts.
+  // The facts that T's function has not been applied to yet are handed to it
+  // in a single batch.
+  FactSet apply(Transfer &T, const FactSet &Facts) {
+    BatchSources.clear();
+    BatchIds.clear();
+    for (auto Fact = Facts.find_first(); Fact != FactSet::npos;
+         Fact = Facts.find_next(Fact)) {
+      if (!T.Targets.count(static_cast<Id>(Fact))) {
+        BatchSources.push_back(FactIds.get(static_cast<Id>(Fact)));
+        BatchIds.push_back(static_cast<Id>(Fact));
+      }
+    }
+    if (!BatchSources.empty()) {
+      PAMM_GET_INSTANCE;
+      INC_COUNTER("FF Application", BatchSources.size(),
+                  PAMM_SEVERITY_LEVEL::Full);
+      Batch.clear();
+      T.Function->computeTargetsBatch(BatchSources, Batch);
+      for (size_t Idx = 0; Idx < Batch.size(); ++Idx) {
+        FactSet Row;
+        for (auto It = Batch.begin(Idx); It != Batch.end(Idx); ++It) {
+          Id TargetId = FactIds.getId(*It);
+          fit(Row).set(TargetId);
+        }
+        T.Targets[BatchIds[Idx]] = std::move(Row);
+      }
+    }
+    FactSet Result(FactIds.size());
+    for (auto Fact = Facts.find_first(); Fact != FactSet::npos;
+         Fact = Facts.find_next(Fact)) {
+      unite(Result, fit(T.Targets[static_cast<Id>(Fact)]));
+    }
+    return Result;
+  }
+
+  /**
+   * Adds the path edges <sP, d1> -> <n, d2> for all d2 in Targets and
+   * schedules the ones that have not been seen before.
+   */
+  void propagate(Id SourceVal, N Target, FactSet Targets) {
+    Id TargetId = NodeIds.getId(Target);
+    uint64_t Key = packIds(TargetId, SourceVal);
+    FactSet &Known = fit(PathEdges[Key]);
+    fit(Targets) -= Known;
+    if (Targets.none()) {
+      return;
+    }
+    Known |= Targets;
+    fit(Reached[TargetId]) |= Targets;
+    auto Pending = Delta.find(Key);
+    if (Pending != Delta.end()) {
+      fit(Pending->second) |= Targets;
+    } else {
+      Delta.emplace(Key, std::move(Targets));
+      WorkList.push_back(Key);
+    }
+  }
+
+  void processCall(Id D1, N n, const FactSet &D2s) {
+    std::set<N> returnSiteNs = icfg.getReturnSitesOfCallAt(n);
+    std::set<M> callees = icfg.getCalleesOfCallAt(n);
+    for (M sCalledProcN : callees) {
+      Transfer &Summary = getSummaryTransfer(n, sCalledProcN);
+      if (Summary.Function) {
+        FactSet Targets = apply(Summary, D2s);
+        for (N returnSiteN : returnSiteNs) {
+          propagate(D1, returnSiteN, Targets);
+        }
+        continue;
+      }
+      Transfer &Call = getCallTransfer(n, sCalledProcN);
+      FactSet D3s = apply(Call, D2s);
+      for (N sP : icfg.getStartPointsOf(sCalledProcN)) {
+        Id SPId = NodeIds.getId(sP);
+        for (auto D3 = D3s.find_first(); D3 != FactSet::npos;
+             D3 = D3s.find_next(D3)) {
+          Id D3Id = static_cast<Id>(D3);
+          // create the initial self-loop
+          propagate(D3Id, sP, singleton(D3Id));
+          // register the incoming edge and apply the already computed end
+          // summaries of <sP, d3>
+          uint64_t SPKey = packIds(SPId, D3Id);
+          fit(Incoming[SPKey][NodeIds.getId(n)]).set(D1);
+          auto Summaries = EndSummaries.find(SPKey);
+          if (Summaries == EndSummaries.end()) {
+            continue;
+          }
+          for (auto &Entry : Summaries->second) {
+            N eP = NodeIds.get(Entry.first);
+            for (N retSiteN : returnSiteNs) {
+              Transfer &Ret =
+                  getReturnTransfer(n, sCalledProcN, eP, retSiteN);
+              propagate(D1, retSiteN, apply(Ret, Entry.second));
+            }
+          }
+        }
+      }
+    }
+    // process intra-procedural flows along call-to-return flow functions
+    for (N returnSiteN : returnSiteNs) {
+      Transfer &CallToRet = getCallToReturnTransfer(n, returnSiteN, callees);
+      propagate(D1, returnSiteN, apply(CallToRet, D2s));
+    }
+  }
+
+  void processExit(Id D1, N n, const FactSet &D2s) {
+    M methodThatNeedsSummary = icfg.getMethodOf(n);
+    Id NId = NodeIds.getId(n);
+    bool HasIncoming = false;
+    for (N sP : icfg.getStartPointsOf(methodThatNeedsSummary)) {
+      uint64_t SPKey = packIds(NodeIds.getId(sP), D1);
+      unite(EndSummaries[SPKey][NId], D2s);
+      auto Inc = Incoming.find(SPKey);
+      if (Inc == Incoming.end()) {
+        continue;
+      }
+      for (auto &Entry : Inc->second) {
+        HasIncoming = true;
+        N c = NodeIds.get(Entry.first);
+        for (N retSiteC : icfg.getReturnSitesOfCallAt(c)) {
+          Transfer &Ret =
+              getReturnTransfer(c, methodThatNeedsSummary, n, retSiteC);
+          FactSet Targets = apply(Ret, D2s);
+          for (auto D3 = Entry.second.find_first(); D3 != FactSet::npos;
+               D3 = Entry.second.find_next(D3)) {
+            propagate(static_cast<Id>(D3), retSiteC, Targets);
+          }
+        }
+      }
+    }
+    // handling for unbalanced problems, see IDESolver::processExit()
+    if (followReturnsPastSeeds && !HasIncoming &&
+        ifdsProblem.isZeroValue(FactIds.get(D1))) {
+      std::set<N> callers = icfg.getCallersOf(methodThatNeedsSummary);
+      Id ZeroId = FactIds.getId(zeroValue);
+      for (N c : callers) {
+        for (N retSiteC : icfg.getReturnSitesOfCallAt(c)) {
+          Transfer &Ret =
+              getReturnTransfer(c, methodThatNeedsSummary, n, retSiteC);
+          propagate(ZeroId, retSiteC, apply(Ret, D2s));
+        }
+      }
+      if (callers.empty()) {
+        Transfer &Ret =
+            getReturnTransfer(nullptr, methodThatNeedsSummary, n, nullptr);
+        apply(Ret, D2s);
+      }
+    }
+  }
+
+  void processNormalFlow(Id D1, N n, const FactSet &D2s) {
+    for (N m : icfg.getSuccsOf(n)) {
+      Transfer &Normal = getNormalTransfer(n, m);
+      propagate(D1, m, apply(Normal, D2s));
+    }
+  }
+
+  void runWorkList() {
+    while (!WorkList.empty()) {
+      uint64_t Key = WorkList.front();
+      WorkList.pop_front();
+      auto Pending = Delta.find(Key);
+      FactSet D2s = std::move(Pending->second);
+      Delta.erase(Pending);
+      N n = NodeIds.get(static_cast<Id>(Key >> 32));
+      Id D1 = static_cast<Id>(Key);
+      if (icfg.isCallStmt(n)) {
+        processCall(D1, n, D2s);
+      } else {
+        if (icfg.isExitStmt(n)) {
+          processExit(D1, n, D2s);
+        }
+        if (!icfg.getSuccsOf(n).empty()) {
+          processNormalFlow(D1, n, D2s);
+        }
+      }
+      if (reachedTermination(n, D2s)) {
+        WorkList.clear();
+        Delta.clear();
+        return;
+      }
+    }
+  }
+
+  bool reachedTermination(N n, const FactSet &D2s) {
+    for (auto Fact = D2s.find_first(); Fact != FactSet::npos;
+         Fact = D2s.find_next(Fact)) {
+      if (ifdsProblem.shouldTerminate(n, FactIds.get(static_cast<Id>(Fact)))) {
+        TerminatedEarly = true;
+        return true;
+      }
+    }
+    return false;
+  }
+
+public:
+  BitVectorIFDSSolver(IFDSTabulationProblem<N, D, M, I> &ifdsProblem)
+      : ifdsProblem(ifdsProblem), icfg(ifdsProblem.interproceduralCFG()),
+        zeroValue(ifdsProblem.zeroValue()),
+        autoAddZero(ifdsProblem.solver_config.autoAddZero),
+        followReturnsPastSeeds(
+            ifdsProblem.solver_config.followReturnsPastSeeds),
+        initialSeeds(ifdsProblem.initialSeeds()) {}
+
+  virtual ~BitVectorIFDSSolver() = default;
+
+  BitVectorIFDSSolver(const BitVectorIFDSSolver &) = delete;
+
+  BitVectorIFDSSolver &operator=(const BitVectorIFDSSolver &) = delete;
+
+  /**
+   * Runs the solver on the configured problem. This can take some time.
+   */
+  virtual void solve() {
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Bit-vector IFDS solver is solving the analysis problem");
+    Id ZeroId = FactIds.getId(zeroValue);
+    for (const auto &seed : initialSeeds) {
+      FactSet Seeds;
+      for (const D &value : seed.second) {
+        Id ValueId = FactIds.getId(value);
+        fit(Seeds).set(ValueId);
+      }
+      propagate(ZeroId, seed.first, std::move(Seeds));
+    }
+    runWorkList();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Bit-vector IFDS solver discovered " << FactIds.size()
+                  << " data-flow facts");
+  }
+
+  /**
+   * Returns whether the problem has stopped the solver before all path edges
+   * have been processed, in which case the results are incomplete.
+   * @see IFDSTabulationProblem::shouldTerminate()
+   */
+  bool terminatedEarly() const { return TerminatedEarly; }
+
+  /**
+   * Returns the data-flow facts that hold at the given statement.
+   */
+  std::set<D> ifdsResultsAt(N stmt) {
+    std::set<D> Result;
+    auto StmtId = NodeIds.findId(stmt);
+    if (!StmtId) {
+      return Result;
+    }
+    auto Search = Reached.find(*StmtId);
+    if (Search == Reached.end()) {
+      return Result;
+    }
+    const FactSet &Facts = Search->second;
+    for (auto Fact = Facts.find_first(); Fact != FactSet::npos;
+         Fact = Facts.find_next(Fact)) {
+      Result.insert(FactIds.get(static_cast<Id>(Fact)));
+    }
+    return Result;
+  }
+
+  /**
+   * Returns the resulting environment for the given statement in the same
+   * shape as IFDSSolver::resultsAt(). The artificial zero value can be
+   * automatically stripped.
+   */
+  std::unordered_map<D, BinaryDomain> resultsAt(N stmt,
+                                                bool stripZero = false) {
+    std::unordered_map<D, BinaryDomain> Result;
+    for (const D &Fact : ifdsResultsAt(stmt)) {
+      if (!stripZero || !ifdsProblem.isZeroValue(Fact)) {
+        Result.insert({Fact, BinaryDomain::BOTTOM});
+      }
+    }
+    return Result;
+  }
+
+  /**
+   * Returns the number of distinct data-flow facts, i.e. the width of the
+   * bit vectors.
+   */
+  size_t getNumFacts() const { return FactIds.size(); }
+};
+
+} // namespace psr
+
+#endif
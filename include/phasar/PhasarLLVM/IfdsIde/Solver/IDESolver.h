@@ -17,15 +17,26 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IDESOLVER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IDESOLVER_H_
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <shared_mutex>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <curl/curl.h>
 #include <json.hpp>
@@ -34,9 +45,11 @@
 
 #include <llvm/Support/raw_ostream.h>
 
+#include <phasar/Config/ContainerConfiguration.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionMemo.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionPtr.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions.h>
-#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowEdgeFunctionCache.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
@@ -46,12 +59,17 @@
 #include <phasar/PhasarLLVM/IfdsIde/Solver/JumpFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LinkedNode.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeWorkList.h>
 #include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
 
+#include <phasar/Utils/Checkpoint.h>
+#include <phasar/Utils/Concurrency.h>
+#include <phasar/Utils/FlatHashMap.h>
+#include <phasar/Utils/FlatTable.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
 #include <phasar/Utils/PAMMMacros.h>
-#include <phasar/Utils/Table.h>
+#include <phasar/Utils/ResultStore.h>
 
 namespace psr {
 
@@ -65,6 +83,13 @@ class IFDSToIDETabulationProblem;
  * Sagiv, Horwitz and Reps. To solve the problem, call solve(). Results
  * can then be queried by using resultAt() and resultsAt().
  *
+ * If SolverConfiguration::numThreads is greater than one, the exploded super
+ * graph is constructed (Phase I) and the values are computed (Phase II) by
+ * several threads. The flow and edge functions as well as the
+ * interprocedural control-flow graph of the problem must then be
+ * thread-safe. PAMM counters are updated atomically and the solver's own
+ * statistics, e.g. the number of processed path edges, are atomic as well.
+ *
  * @param <N> The type of nodes in the interprocedural control-flow graph.
  * @param <D> The type of data-flow facts to be computed by the tabulation
  * problem.
@@ -86,11 +111,25 @@ public:
         computePersistedSummaries(
             tabulationProblem.solver_config.computePersistedSummaries),
         recordEdges(tabulationProblem.solver_config.recordEdges),
-        PathEdgeCount(0), cachedFlowEdgeFunctions(tabulationProblem),
+        PathEdgeCount(0),
+        WorkList(tabulationProblem.solver_config.workListStrategy),
+        NumThreads(tabulationProblem.solver_config.numThreads),
+        PropagationMtxs(NumThreads > 1 ? NumLockStripes : 1),
+        ValuePropagationMtxs(NumThreads > 1 ? NumLockStripes : 1),
+        cachedFlowEdgeFunctions(tabulationProblem),
+        EFMemo(tabulationProblem.solver_config.edgeFunctionMemoSize,
+               NumThreads > 1),
         allTop(tabulationProblem.allTopFunction()),
         jumpFn(std::make_shared<JumpFunctions<N, D, M, V, I>>(
-            allTop, ideTabulationProblem)),
+            allTop, ideTabulationProblem,
+            NumThreads > 1 ? NumLockStripes : 1)),
         initialSeeds(tabulationProblem.initialSeeds()) {
+    if (NumThreads > 1) {
+      ConcurrentWorkList =
+          std::make_unique<WorkStealingQueue<PathEdge<N, D>>>(NumThreads);
+      ConcurrentValueWorkList =
+          std::make_unique<WorkStealingQueue<std::pair<N, D>>>(NumThreads);
+    }
     // std::cout << "called IDESolver::IDESolver() ctor with IDEProblem"
     //           << std::endl;
   }
@@ -100,28 +139,32 @@ public:
   json getAsJson() {
     const static std::string DataFlowID = "DataFlow";
     json J;
-    auto results = this->valtab.cellSet();
-    if (results.empty()) {
+    computeRemainingValues();
+    if (valtab.empty()) {
       J[DataFlowID] = "EMPTY";
     } else {
-      std::vector<typename Table<N, D, V>::Cell> cells;
-      for (auto cell : results) {
-        cells.push_back(cell);
+      // sort pointers to the cells rather than copies of them
+      std::vector<const typename FlatTable<N, D, V>::Cell *> cells;
+      cells.reserve(valtab.size());
+      for (auto &cell : valtab) {
+        cells.push_back(&cell);
       }
       sort(cells.begin(), cells.end(),
-           [](typename Table<N, D, V>::Cell a,
-              typename Table<N, D, V>::Cell b) { return a.r < b.r; });
+           [](const typename FlatTable<N, D, V>::Cell *a,
+              const typename FlatTable<N, D, V>::Cell *b) {
+             return a->r < b->r;
+           });
       N curr;
       for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
-        std::string n = ideTabulationProblem.NtoString(cells[i].r);
+        curr = cells[i]->r;
+        std::string n = ideTabulationProblem.NtoString(cells[i]->r);
         boost::algorithm::trim(n);
         std::string node =
             icfg.getMethodName(icfg.getMethodOf(curr)) + "::" + n;
         J[DataFlowID][node];
-        std::string fact = ideTabulationProblem.DtoString(cells[i].c);
+        std::string fact = ideTabulationProblem.DtoString(cells[i]->c);
         boost::algorithm::trim(fact);
-        std::string value = ideTabulationProblem.VtoString(cells[i].v);
+        std::string value = ideTabulationProblem.VtoString(cells[i]->v);
         boost::algorithm::trim(value);
         J[DataFlowID][node]["Facts"] += {fact, value};
       }
@@ -307,9 +350,11 @@ public:
   }
 
   /**
-   * @brief Runs the solver on the configured problem. This can take some time.
+   * Registers the solver's performance counters with PAMM. Each run
+   * registers them, which is a no-op once they exist. Callers that run
+   * several solvers concurrently must call this before starting them.
    */
-  virtual void solve() {
+  static void registerCounters() {
     PAMM_GET_INSTANCE;
     REG_COUNTER("Gen facts", 0, PAMM_SEVERITY_LEVEL::Core);
     REG_COUNTER("Kill facts", 0, PAMM_SEVERITY_LEVEL::Core);
@@ -323,43 +368,174 @@ public:
     REG_COUNTER("SpecialSummary-FF Application", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("SpecialSummary-EF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("JumpFn Construction", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Path Edge Updates", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Path Edges Coalesced", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Path Edges Deferred", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Path Edges Skipped", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Process Call", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Process Normal", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Process Exit", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("[Calls] getPointsToSet", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_HISTOGRAM("Data-flow facts", PAMM_SEVERITY_LEVEL::Full);
     REG_HISTOGRAM("Points-to", PAMM_SEVERITY_LEVEL::Full);
+  }
+
+  /**
+   * @brief Runs the solver on the configured problem. This can take some time.
+   */
+  virtual void solve() {
+    PAMM_GET_INSTANCE;
+    registerCounters();
 
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                   << "IDE solver is solving the specified problem");
+    startCheckpoints();
     // computations starting here
     START_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
     // We start our analysis and construct exploded supergraph
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                   << "Submit initial seeds, construct exploded super graph");
-    submitInitalSeeds();
+    if (Demanding) {
+      // continue with the exploded super graph that has been constructed
+      // for earlier queries, the values are computed from scratch
+      Demanding = false;
+      ChangedCallJumpFns.clear();
+      releaseDeferredEdges();
+      runWorkList();
+      valtab.clear();
+    } else {
+      submitInitalSeeds();
+    }
     STOP_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
-    if (computevalues) {
-      START_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
-      // Computing the final values for the edge functions
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Compute the final values according to the edge functions");
-      computeValues();
-      STOP_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+    completeSolving(false);
+  }
+
+  /**
+   * Continues solving the problem from the checkpoint at the given path,
+   * which has been written by a solver for the same problem on the same
+   * program, see SolverConfiguration::checkpointFile. Is called on a fresh
+   * solver instead of solve(). Throws std::ios_base::failure if the
+   * checkpoint cannot be read and std::runtime_error if it does not match
+   * the program.
+   */
+  virtual void resume(const std::string &path) {
+    PAMM_GET_INSTANCE;
+    registerCounters();
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "IDE solver is resuming from checkpoint " << path);
+    SolverPhase phase = readCheckpoint(path);
+    startCheckpoints();
+    if (phase == SolverPhase::ExplodedSuperGraph) {
+      START_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
+      runWorkList();
+      STOP_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Problem solved");
-    if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
-      computeAndPrintStatistics();
+    completeSolving(phase == SolverPhase::ValuePropagation);
+  }
+
+  /**
+   * Solves the problem on demand for the given statements only. The exploded
+   * super graph is constructed for the part of the interprocedural
+   * control-flow graph that may reach one of the statements, and values are
+   * computed only for these statements. Their results can then be queried
+   * using resultAt() and resultsAt().
+   *
+   * Subsequent calls reuse the exploded super graph of earlier calls and
+   * only construct the parts that are additionally required. Calling solve()
+   * afterwards completes the exploded super graph and computes all values;
+   * calling solveFor() after solve() has no effect.
+   */
+  void solveFor(const std::set<N> &stmts) {
+    if (ExhaustivelySolved) {
+      return;
+    }
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "IDE solver is solving the specified problem for "
+                  << stmts.size() << " statement(s) on demand");
+    registerCounters();
+    addRelevantNodes(stmts);
+    if (!Demanding) {
+      Demanding = true;
+      submitInitalSeeds();
+    } else {
+      releaseDeferredEdges();
+      runWorkList();
+    }
+    if (!computevalues || TerminatedEarly) {
+      return;
+    }
+    std::set<N> pending;
+    if (PathEdgeCount != PathEdgeCountAtValues) {
+      // the exploded super graph has grown since the values have been
+      // computed last; the values only move down the lattice along with it,
+      // hence they are updated from where the graph has changed and the
+      // values of all queried statements are joined with their new values
+      if (ValuesPropagated) {
+        propagateChangedValues();
+      } else {
+        ChangedCallJumpFns.clear();
+        propagateValuesFromSeeds();
+        ValuesPropagated = true;
+      }
+      PathEdgeCountAtValues = PathEdgeCount;
+      pending = QueriedNodes;
     }
+    for (N n : stmts) {
+      if (QueriedNodes.insert(n).second) {
+        pending.insert(n);
+      }
+    }
+    // the values at start points and call sites have been computed by
+    // propagateValuesFromSeeds() already
+    std::unordered_set<N> Done;
+    for (N n : pending) {
+      if (!icfg.isCallStmt(n) && !icfg.isStartPoint(n) && !Done.count(n)) {
+        computeChainValues(n, Done, valtab, true);
+      }
+    }
+  }
+
+  /**
+   * Returns the V-type result for the given value at the given statement,
+   * solving the problem on demand for the statement if necessary.
+   * @see solveFor()
+   */
+  V resultAtOnDemand(N stmt, D value) {
+    solveFor({stmt});
+    return resultAt(stmt, value);
   }
 
+  /**
+   * Returns the resulting environment for the given statement, solving the
+   * problem on demand for the statement if necessary.
+   * @see solveFor()
+   */
+  std::unordered_map<D, V> resultsAtOnDemand(N stmt, bool stripZero = false) {
+    solveFor({stmt});
+    return resultsAt(stmt, stripZero);
+  }
+
+  /**
+   * Returns whether the problem has stopped the solver before the exploded
+   * super graph has been fully constructed, in which case the results are
+   * incomplete.
+   * @see IFDSTabulationProblem::shouldTerminate()
+   */
+  bool terminatedEarly() const { return TerminatedEarly; }
+
   /**
    * Returns the V-type result for the given value at the given statement.
-   * TOP values are never returned.
+   * TOP values are never returned. Once the problem has been solved, results
+   * can be queried from several threads at once.
    */
-  virtual V resultAt(N stmt, D value) { return valtab.get(stmt, value); }
+  virtual V resultAt(N stmt, D value) {
+    auto Lock = computeValuesAt(stmt);
+    const V *Value = valtab.find(stmt, value);
+    return Value ? *Value : V();
+  }
 
   /**
    * Returns the resulting environment for the given statement.
@@ -367,6 +543,7 @@ public:
    * TOP values are never returned.
    */
   virtual std::unordered_map<D, V> resultsAt(N stmt, bool stripZero = false) {
+    auto Lock = computeValuesAt(stmt);
     std::unordered_map<D, V> result = valtab.row(stmt);
     if (stripZero) {
       for (auto it = result.begin(); it != result.end();) {
@@ -380,7 +557,88 @@ public:
     return result;
   }
 
+  /**
+   * Computes the values at all nodes whose values have not been computed
+   * yet if SolverConfiguration::lazyValueComputation is enabled, such that
+   * the value table is complete.
+   */
+  void computeRemainingValues() {
+    if (!hasLazyValues()) {
+      return;
+    }
+    for (N n : icfg.allNonCallStartNodes()) {
+      computeValuesAt(n);
+    }
+  }
+
+  /**
+   * Writes the values at all nodes into a result store file at the given
+   * path, in which the nodes are identified by their statement ids and
+   * grouped by their methods; see ResultStore. Values that have not been
+   * computed yet are computed method by method and streamed into the file
+   * rather than added to the value table, such that the results of large
+   * programs can be exported without keeping all of them in memory.
+   */
+  void writeResultStore(const std::string &path) {
+    std::unique_lock<std::mutex> Lock;
+    if (hasLazyValues()) {
+      Lock = std::unique_lock<std::mutex>(LazyValuesMtx);
+    }
+    std::map<std::string, std::map<std::string, N>> nodesByMethod;
+    auto addNode = [&](N n) {
+      nodesByMethod[icfg.getMethodName(icfg.getMethodOf(n))].emplace(
+          icfg.getStatementId(n), n);
+    };
+    for (const auto &cell : valtab) {
+      addNode(cell.r);
+    }
+    if (hasLazyValues()) {
+      for (N n : icfg.allNonCallStartNodes()) {
+        addNode(n);
+      }
+    }
+    ResultStoreWriter writer(path);
+    for (const auto &method : nodesByMethod) {
+      writer.beginFunction(method.first);
+      std::vector<N> pending;
+      for (const auto &node : method.second) {
+        N n = node.second;
+        if (hasLazyValues() && !icfg.isCallStmt(n) && !icfg.isStartPoint(n) &&
+            !NodesWithValues.count(n)) {
+          pending.push_back(n);
+        }
+      }
+      FlatTable<N, D, V> lazyValues;
+      valueComputationTask(pending, 0, pending.size(), lazyValues);
+      if (ideTabulationProblem.solver_config.sparsePropagation) {
+        std::unordered_set<N> Done;
+        for (N n : pending) {
+          if (!Done.count(n)) {
+            computeChainValues(n, Done, lazyValues, false);
+          }
+        }
+      }
+      for (const auto &node : method.second) {
+        writer.beginNode(node.first);
+        const FlatTable<N, D, V> &values =
+            lazyValues.containsRow(node.second) ? lazyValues : valtab;
+        values.foreachInRow(node.second, [&](D d, const V &v) {
+          writer.addResult(ideTabulationProblem.DtoString(d),
+                           ideTabulationProblem.VtoString(v));
+        });
+      }
+    }
+    writer.finish();
+  }
+
 protected:
+  // a checkpoint either belongs to Phase I or to Phase II(i)
+  enum class SolverPhase : uint64_t {
+    ExplodedSuperGraph = 1,
+    ValuePropagation = 2
+  };
+  static constexpr uint32_t CheckpointVersion = 1;
+
   // have a shared point to allow for a copy constructor of IDESolver
   std::shared_ptr<IFDSToIDETabulationProblem<N, D, M, I>> transformedProblem;
   IDETabulationProblem<N, D, M, V, I> &ideTabulationProblem;
@@ -413,7 +671,7 @@ protected:
     D d1 = edge.factAtSource();
     N n = edge.getTarget(); // a call node; line 14...
     D d2 = edge.factAtTarget();
-    std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
+    EdgeFunctionPtr<V> f = jumpFunction(edge);
     std::set<N> returnSiteNs = icfg.getReturnSitesOfCallAt(n);
     std::set<M> callees = icfg.getCalleesOfCallAt(n);
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Possible callees:");
@@ -437,23 +695,23 @@ protected:
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Found and process special summary");
         for (N returnSiteN : returnSiteNs) {
-          std::set<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
+          FFSet<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
           INC_COUNTER("SpecialSummary-FF Application", 1,
                       PAMM_SEVERITY_LEVEL::Full);
           ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                            PAMM_SEVERITY_LEVEL::Full);
           saveEdges(n, returnSiteN, d2, res, false);
           for (D d3 : res) {
-            std::shared_ptr<EdgeFunction<V>> sumEdgFnE =
+            EdgeFunctionPtr<V> sumEdgFnE =
                 cachedFlowEdgeFunctions.getSummaryEdgeFunction(n, d2,
                                                                returnSiteN, d3);
             INC_COUNTER("SpecialSummary-EF Queries", 1,
                         PAMM_SEVERITY_LEVEL::Full);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << sumEdgFnE->str() << " * "
-                          << f->str());
+                          << "Compose: " << sumEdgFnE.str() << " * "
+                          << f.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-            propagate(d1, returnSiteN, d3, f->composeWith(sumEdgFnE), n, false);
+            propagate(d1, returnSiteN, d3, compose(f, sumEdgFnE), n, false);
           }
         }
       } else {
@@ -461,7 +719,7 @@ protected:
         std::shared_ptr<FlowFunction<D>> function =
             cachedFlowEdgeFunctions.getCallFlowFunction(n, sCalledProcN);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> res = computeCallFlowFunction(function, d1, d2);
+        FFSet<D> res = computeCallFlowFunction(function, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                          PAMM_SEVERITY_LEVEL::Full);
         // for each callee's start point(s)
@@ -478,18 +736,20 @@ protected:
           // for each result node of the call-flow function
           for (D d3 : res) {
             // create initial self-loop
-            propagate(d3, sP, d3, EdgeIdentity<V>::getInstance(), n,
+            propagate(d3, sP, d3, EdgeFunctionPtr<V>::identity(), n,
                       false); // line 15
             // register the fact that <sp,d3> has an incoming edge from <n,d2>
             // line 15.1 of Naeem/Lhotak/Rodriguez
-            addIncoming(sP, d3, n, d2);
             // line 15.2, copy to avoid concurrent modification exceptions by
-            // other threads
-            std::set<
-                typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
-                endSumm = std::set<typename Table<
-                    N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>(
-                    endSummary(sP, d3));
+            // other threads; registering the incoming edge and reading the
+            // end summaries must happen atomically w.r.t. processExit()
+            std::vector<typename FlatTable<N, D, EdgeFunctionPtr<V>>::Cell>
+                endSumm;
+            {
+              auto Lock = lockIfConcurrent(SummaryMtx);
+              addIncoming(sP, d3, n, d2);
+              endSumm = endSummary(sP, d3);
+            }
             // std::cout << "ENDSUMM" << std::endl;
             // std::cout << "Size: " << endSumm.size() << std::endl;
             // std::cout << "sP: " << ideTabulationProblem.NtoString(sP)
@@ -501,12 +761,10 @@ protected:
             // <sP,d3>, create new caller-side jump functions to the return
             // sites because we have observed a potentially new incoming
             // edge into <sP,d3>
-            for (typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell
-                     entry : endSumm) {
+            for (auto &entry : endSumm) {
               N eP = entry.getRowKey();
               D d4 = entry.getColumnKey();
-              std::shared_ptr<EdgeFunction<V>> fCalleeSummary =
-                  entry.getValue();
+              EdgeFunctionPtr<V> fCalleeSummary = entry.getValue();
               // for each return site
               for (N retSiteN : returnSiteNs) {
                 // compute return-flow function
@@ -514,7 +772,7 @@ protected:
                     cachedFlowEdgeFunctions.getRetFlowFunction(n, sCalledProcN,
                                                                eP, retSiteN);
                 INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-                std::set<D> returnedFacts = computeReturnFlowFunction(
+                FFSet<D> returnedFacts = computeReturnFlowFunction(
                     retFunction, d3, d4, n, std::set<D>{d2});
                 ADD_TO_HISTOGRAM("Data-flow facts", returnedFacts.size(), 1,
                                  PAMM_SEVERITY_LEVEL::Full);
@@ -523,33 +781,33 @@ protected:
                 for (D d5 : returnedFacts) {
                   // update the caller-side summary function
                   // get call edge function
-                  std::shared_ptr<EdgeFunction<V>> f4 =
+                  EdgeFunctionPtr<V> f4 =
                       cachedFlowEdgeFunctions.getCallEdgeFunction(
                           n, d2, sCalledProcN, d3);
                   // get return edge function
-                  std::shared_ptr<EdgeFunction<V>> f5 =
+                  EdgeFunctionPtr<V> f5 =
                       cachedFlowEdgeFunctions.getReturnEdgeFunction(
                           n, sCalledProcN, eP, d4, retSiteN, d5);
                   INC_COUNTER("EF Queries", 2, PAMM_SEVERITY_LEVEL::Full);
                   // compose call * calleeSummary * return edge functions
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Compose: " << f5->str() << " * "
-                                << fCalleeSummary->str() << " * " << f4->str());
+                                << "Compose: " << f5.str() << " * "
+                                << fCalleeSummary.str() << " * " << f4.str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                                 << "         (return * calleeSummary * call)");
-                  std::shared_ptr<EdgeFunction<V>> fPrime =
-                      f4->composeWith(fCalleeSummary)->composeWith(f5);
+                  EdgeFunctionPtr<V> fPrime =
+                      compose(compose(f4, fCalleeSummary), f5);
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "       = " << fPrime->str());
+                                << "       = " << fPrime.str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
                   D d5_restoredCtx = restoreContextOnReturnedFact(n, d2, d5);
                   // propagte the effects of the entire call
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Compose: " << fPrime->str() << " * "
-                                << f->str());
+                                << "Compose: " << fPrime.str() << " * "
+                                << f.str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
                   propagate(d1, retSiteN, d5_restoredCtx,
-                            f->composeWith(fPrime), n, false);
+                            compose(f, fPrime), n, false);
                 }
               }
             }
@@ -563,20 +821,20 @@ protected:
             cachedFlowEdgeFunctions.getCallToRetFlowFunction(n, returnSiteN,
                                                              callees);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> returnFacts =
+        FFSet<D> returnFacts =
             computeCallToReturnFlowFunction(callToReturnFlowFunction, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", returnFacts.size(), 1,
                          PAMM_SEVERITY_LEVEL::Full);
         saveEdges(n, returnSiteN, d2, returnFacts, false);
         for (D d3 : returnFacts) {
-          std::shared_ptr<EdgeFunction<V>> edgeFnE =
+          EdgeFunctionPtr<V> edgeFnE =
               cachedFlowEdgeFunctions.getCallToRetEdgeFunction(
                   n, d2, returnSiteN, d3, callees);
           INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Compose: " << edgeFnE->str() << " * " << f->str());
+                        << "Compose: " << edgeFnE.str() << " * " << f.str());
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-          propagate(d1, returnSiteN, d3, f->composeWith(edgeFnE), n, false);
+          propagate(d1, returnSiteN, d3, compose(f, edgeFnE), n, false);
         }
       }
     }
@@ -597,22 +855,22 @@ protected:
     D d1 = edge.factAtSource();
     N n = edge.getTarget();
     D d2 = edge.factAtTarget();
-    std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
+    EdgeFunctionPtr<V> f = jumpFunction(edge);
     auto successorInst = icfg.getSuccsOf(n);
     for (auto m : successorInst) {
       std::shared_ptr<FlowFunction<D>> flowFunction =
           cachedFlowEdgeFunctions.getNormalFlowFunction(n, m);
       INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-      std::set<D> res = computeNormalFlowFunction(flowFunction, d1, d2);
+      FFSet<D> res = computeNormalFlowFunction(flowFunction, d1, d2);
       ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                        PAMM_SEVERITY_LEVEL::Full);
       saveEdges(n, m, d2, res, false);
       for (D d3 : res) {
-        std::shared_ptr<EdgeFunction<V>> g =
+        EdgeFunctionPtr<V> g =
             cachedFlowEdgeFunctions.getNormalEdgeFunction(n, d2, m, d3);
-        std::shared_ptr<EdgeFunction<V>> fprime = f->composeWith(g);
+        EdgeFunctionPtr<V> fprime = compose(f, g);
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Compose: " << g->str() << " * " << f->str());
+                      << "Compose: " << g.str() << " * " << f.str());
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
         INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         propagate(d1, m, d3, fprime, nullptr, false);
@@ -625,14 +883,13 @@ protected:
     D d = nAndD.second;
     M p = icfg.getMethodOf(n);
     for (N c : icfg.getCallsFromWithin(p)) {
-      for (auto entry : jumpFn->forwardLookup(d, c)) {
-        D dPrime = entry.first;
-        std::shared_ptr<EdgeFunction<V>> fPrime = entry.second;
-        N sP = n;
-        V value = val(sP, d);
-        INC_COUNTER("Value Propagation", 1, PAMM_SEVERITY_LEVEL::Full);
-        propagateValue(c, dPrime, fPrime->computeTarget(value));
-      }
+      jumpFn->lookupByTargetView(c).foreachInRow(
+          d, [&](D dPrime, const EdgeFunctionPtr<V> &fPrime) {
+            N sP = n;
+            V value = val(sP, d);
+            INC_COUNTER("Value Propagation", 1, PAMM_SEVERITY_LEVEL::Full);
+            propagateValue(c, dPrime, fPrime.computeTarget(value));
+          });
     }
   }
 
@@ -644,29 +901,73 @@ protected:
           cachedFlowEdgeFunctions.getCallFlowFunction(n, q);
       INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
       for (D dPrime : callFlowFunction->computeTargets(d)) {
-        std::shared_ptr<EdgeFunction<V>> edgeFn =
+        EdgeFunctionPtr<V> edgeFn =
             cachedFlowEdgeFunctions.getCallEdgeFunction(n, d, q, dPrime);
         INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         for (N startPoint : icfg.getStartPointsOf(q)) {
           INC_COUNTER("Value Propagation", 1, PAMM_SEVERITY_LEVEL::Full);
-          propagateValue(startPoint, dPrime, edgeFn->computeTarget(val(n, d)));
+          propagateValue(startPoint, dPrime, edgeFn.computeTarget(val(n, d)));
         }
       }
     }
   }
 
   void propagateValue(N nHashN, D nHashD, V v) {
+    // the read, join and update of the value must not interleave with
+    // another thread propagating a value to the same node
+    auto Lock = lockIfConcurrent(ValuePropagationMtxs[shardIndex(
+        nHashN, ValuePropagationMtxs.size())]);
     V valNHash = val(nHashN, nHashD);
     V vPrime = joinValueAt(nHashN, nHashD, valNHash, v);
     if (!(vPrime == valNHash)) {
       setVal(nHashN, nHashD, vPrime);
-      valuePropagationTask(std::pair<N, D>(nHashN, nHashD));
+      // the node is processed later on with the value that is current at
+      // that time
+      if (ConcurrentValueWorkList) {
+        ConcurrentValueWorkList->push(std::make_pair(nHashN, nHashD));
+      } else {
+        ValueWorkList.push_back(std::make_pair(nHashN, nHashD));
+      }
+    }
+  }
+
+  /**
+   * Processes the pending nodes of Phase II(i) until their values have
+   * reached a fixed point.
+   */
+  void runValueWorkList() {
+    if (ConcurrentValueWorkList) {
+      while (true) {
+        ConcurrentValueWorkList->run([this](std::pair<N, D> nAndD) {
+          valuePropagationTask(nAndD);
+          if (checkpointDue()) {
+            ConcurrentValueWorkList->interrupt();
+          }
+        });
+        if (ConcurrentValueWorkList->empty()) {
+          return;
+        }
+        // the workers have been interrupted to take a checkpoint
+        takeCheckpoint(SolverPhase::ValuePropagation);
+      }
+    }
+    while (!ValueWorkList.empty()) {
+      std::pair<N, D> nAndD = ValueWorkList.back();
+      ValueWorkList.pop_back();
+      valuePropagationTask(nAndD);
+      if (checkpointDue()) {
+        takeCheckpoint(SolverPhase::ValuePropagation);
+      }
     }
   }
 
   V val(N nHashN, D nHashD) {
-    if (valtab.contains(nHashN, nHashD)) {
-      return valtab.get(nHashN, nHashD);
+    std::shared_lock<std::shared_mutex> Lock;
+    if (NumThreads > 1) {
+      Lock = std::shared_lock<std::shared_mutex>(ValtabMtx);
+    }
+    if (const V *Value = valtab.find(nHashN, nHashD)) {
+      return *Value;
     } else {
       // implicitly initialized to top; see line [1] of Fig. 7 in SRH96 paper
       return ideTabulationProblem.topElement();
@@ -674,13 +975,21 @@ protected:
   }
 
   void setVal(N nHashN, D nHashD, V l) {
+    std::unique_lock<std::shared_mutex> Lock;
+    if (NumThreads > 1) {
+      Lock = std::unique_lock<std::shared_mutex>(ValtabMtx);
+    }
+    setVal(valtab, nHashN, nHashD, l);
+  }
+
+  void setVal(FlatTable<N, D, V> &Values, N nHashN, D nHashD, V l) {
     auto &lg = lg::get();
     // TOP is the implicit default value which we do not need to store.
     if (l == ideTabulationProblem.topElement()) {
       // do not store top values
-      valtab.remove(nHashN, nHashD);
+      Values.remove(nHashN, nHashD);
     } else {
-      valtab.insert(nHashN, nHashD, l);
+      Values.insert(nHashN, nHashD, l);
     }
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "Function : "
@@ -694,24 +1003,742 @@ protected:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
   }
 
-  std::shared_ptr<EdgeFunction<V>> jumpFunction(PathEdge<N, D> edge) {
-    if (!jumpFn->forwardLookup(edge.factAtSource(), edge.getTarget())
-             .count(edge.factAtTarget())) {
+  EdgeFunctionPtr<V> jumpFunction(PathEdge<N, D> edge) {
+    EdgeFunctionPtr<V> function = jumpFn->getFunction(
+        edge.factAtSource(), edge.getTarget(), edge.factAtTarget());
+    if (!function) {
       // JumpFn initialized to all-top, see line [2] in SRH96 paper
       return allTop;
     }
-    return jumpFn->forwardLookup(edge.factAtSource(),
-                                 edge.getTarget())[edge.factAtTarget()];
+    return function;
   }
 
-  void addEndSummary(N sP, D d1, N eP, D d2,
-                     std::shared_ptr<EdgeFunction<V>> f) {
+  void addEndSummary(N sP, D d1, N eP, D d2, EdgeFunctionPtr<V> f) {
     // note: at this point we don't need to join with a potential previous f
     // because f is a jump function, which is already properly joined
     // within propagate(..)
     endsummarytab.get(sP, d1).insert(eP, d2, f);
   }
 
+  /**
+   * Processes the pending path edges until the work list has been drained,
+   * i.e. until the exploded super graph has been fully constructed.
+   */
+  void runWorkList() {
+    if (ConcurrentWorkList) {
+      while (true) {
+        ConcurrentWorkList->run([this](PathEdge<N, D> edge) {
+          pathEdgeProcessingTask(edge);
+          if (reachedTermination(edge)) {
+            ConcurrentWorkList->cancel();
+          } else if (checkpointDue()) {
+            ConcurrentWorkList->interrupt();
+          }
+        });
+        if (ConcurrentWorkList->empty()) {
+          return;
+        }
+        // the workers have been interrupted to take a checkpoint
+        takeCheckpoint(SolverPhase::ExplodedSuperGraph);
+      }
+    }
+    bool ReleaseMethods =
+        ideTabulationProblem.solver_config.releaseFinishedMethods &&
+        WorkList.isGroupedByMethod();
+    std::vector<PathEdge<N, D>> Batch;
+    while (!WorkList.empty()) {
+      Batch.clear();
+      WorkList.popBatch(Batch);
+      N Target = Batch.front().getTarget();
+      batchFlowTargets(Batch);
+      bool Terminated = false;
+      for (const auto &edge : Batch) {
+        pathEdgeProcessingTask(edge);
+        if (reachedTermination(edge)) {
+          Terminated = true;
+          break;
+        }
+      }
+      BatchTargets.clear();
+      BatchFunctions.clear();
+      if (Terminated) {
+        WorkList.clear();
+        break;
+      }
+      if (ReleaseMethods) {
+        // the cached functions of a finished method are only needed again if
+        // new path edges reach it later on
+        M Method = icfg.getMethodOf(Target);
+        if (!WorkList.hasPendingEdges(Method)) {
+          cachedFlowEdgeFunctions.releaseMethod(Method);
+        }
+      }
+      if (checkpointDue()) {
+        takeCheckpoint(SolverPhase::ExplodedSuperGraph);
+      }
+    }
+  }
+
+  /**
+   * Applies the flow functions that the path edges of Batch, which all end at
+   * the same node, are about to be processed with to all of their facts at
+   * once: there is a single computeTargetsBatch() call per flow function. The
+   * targets are kept in BatchTargets, where the compute*FlowFunction()
+   * functions look them up while the edges are processed.
+   */
+  void batchFlowTargets(const std::vector<PathEdge<N, D>> &Batch) {
+    N n = Batch.front().getTarget();
+    if (icfg.isCallStmt(n)) {
+      std::vector<D> Facts;
+      for (const auto &edge : Batch) {
+        Facts.push_back(edge.factAtTarget());
+      }
+      std::set<M> callees = icfg.getCalleesOfCallAt(n);
+      for (M callee : callees) {
+        // a special summary replaces the call flow, see processCall()
+        std::shared_ptr<FlowFunction<D>> specialSum =
+            cachedFlowEdgeFunctions.getSummaryFlowFunction(n, callee);
+        batchFlowTargets(specialSum
+                             ? specialSum
+                             : cachedFlowEdgeFunctions.getCallFlowFunction(
+                                   n, callee),
+                         Facts);
+      }
+      for (N returnSiteN : icfg.getReturnSitesOfCallAt(n)) {
+        batchFlowTargets(cachedFlowEdgeFunctions.getCallToRetFlowFunction(
+                             n, returnSiteN, callees),
+                         Facts);
+      }
+      return;
+    }
+    if (icfg.isExitStmt(n)) {
+      // the return flows are applied per call site that has an incoming edge
+      // for the fact at the method's start point
+      M method = icfg.getMethodOf(n);
+      std::set<N> startPointsOf = icfg.getStartPointsOf(method);
+      std::map<N, std::vector<D>> FactsPerCallSite;
+      {
+        auto Lock = lockIfConcurrent(SummaryMtx);
+        for (const auto &edge : Batch) {
+          for (N sP : startPointsOf) {
+            for (auto &entry : incoming(edge.factAtSource(), sP)) {
+              FactsPerCallSite[entry.first].push_back(edge.factAtTarget());
+            }
+          }
+        }
+      }
+      for (auto &entry : FactsPerCallSite) {
+        N c = entry.first;
+        for (N retSiteC : icfg.getReturnSitesOfCallAt(c)) {
+          batchFlowTargets(cachedFlowEdgeFunctions.getRetFlowFunction(
+                               c, method, n, retSiteC),
+                           entry.second);
+        }
+      }
+    }
+    std::vector<D> Facts;
+    for (const auto &edge : Batch) {
+      // skippable nodes are passed without applying their flow functions
+      if (!isSkippable(n, edge.factAtTarget())) {
+        Facts.push_back(edge.factAtTarget());
+      }
+    }
+    for (N m : icfg.getSuccsOf(n)) {
+      batchFlowTargets(cachedFlowEdgeFunctions.getNormalFlowFunction(n, m),
+                       Facts);
+    }
+  }
+
+  void batchFlowTargets(std::shared_ptr<FlowFunction<D>> Function,
+                        std::vector<D> Facts) {
+    std::sort(Facts.begin(), Facts.end());
+    Facts.erase(std::unique(Facts.begin(), Facts.end()), Facts.end());
+    // a single fact is not worth the detour
+    if (Facts.size() < 2) {
+      return;
+    }
+    TargetBuffer<D> Targets;
+    Function->computeTargetsBatch(Facts, Targets);
+    for (size_t Idx = 0; Idx < Facts.size(); ++Idx) {
+      BatchTargets.insert(std::make_tuple(Function.get(), Facts[Idx]),
+                          FFSet<D>(Targets.begin(Idx), Targets.end(Idx)));
+    }
+    // keeps the function alive, its address is part of the keys above
+    BatchFunctions.push_back(std::move(Function));
+  }
+
+  /**
+   * Returns the targets of the given flow function for fact d, as computed
+   * by batchFlowTargets() for the current batch if possible.
+   */
+  FFSet<D> flowTargets(const std::shared_ptr<FlowFunction<D>> &Function,
+                       D d) {
+    if (const FFSet<D> *Targets =
+            BatchTargets.find(std::make_tuple(Function.get(), d))) {
+      return *Targets;
+    }
+    return Function->computeTargets(d);
+  }
+
+  /**
+   * Runs Phase II after Phase I has been completed, or only the rest of
+   * Phase II(i) and Phase II(ii) if the solver has been resumed from a
+   * checkpoint of Phase II(i).
+   */
+  void completeSolving(bool resumeValuePropagation) {
+    PAMM_GET_INSTANCE;
+    auto &lg = lg::get();
+    // the exploded super graph is incomplete if the problem has requested to
+    // terminate early, hence there is no point in computing values
+    if (computevalues && !TerminatedEarly) {
+      START_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+      // Computing the final values for the edge functions
+      LOG_IF_ENABLE(
+          BOOST_LOG_SEV(lg, INFO)
+          << "Compute the final values according to the edge functions");
+      if (resumeValuePropagation) {
+        runValueWorkList();
+        computeNonCallStartValues();
+      } else {
+        computeValues();
+      }
+      STOP_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+    }
+    CheckpointGuard.reset();
+    ExhaustivelySolved = true;
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Problem solved");
+    if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
+      computeAndPrintStatistics();
+    }
+  }
+
+  /**
+   * Starts to take checkpoints if a checkpoint file has been configured.
+   * Checkpoints are taken until the problem has been solved.
+   */
+  void startCheckpoints() {
+    if (ideTabulationProblem.solver_config.checkpointFile.empty()) {
+      return;
+    }
+    CheckpointGuard = std::make_unique<TerminationSignalGuard>();
+    NextCheckpoint =
+        std::chrono::steady_clock::now() +
+        std::chrono::seconds(
+            ideTabulationProblem.solver_config.checkpointInterval);
+  }
+
+  /**
+   * Returns whether a checkpoint has to be taken, either because the
+   * checkpoint interval has elapsed or because the process has received
+   * SIGTERM. Polled after each path edge and value propagation.
+   */
+  bool checkpointDue() {
+    if (!CheckpointGuard) {
+      return false;
+    }
+    if (TerminationSignalGuard::isPending()) {
+      return true;
+    }
+    // reading the clock for every path edge would be needlessly expensive
+    return ideTabulationProblem.solver_config.checkpointInterval > 0 &&
+           ++CheckpointPolls % 1024 == 0 &&
+           std::chrono::steady_clock::now() >= NextCheckpoint;
+  }
+
+  /**
+   * Writes a checkpoint of the given phase into the checkpoint file and
+   * terminates the process afterwards if it has received SIGTERM. Since the
+   * solver can proceed without the checkpoint, failures are only logged.
+   */
+  void takeCheckpoint(SolverPhase phase) {
+    auto &lg = lg::get();
+    const std::string &path =
+        ideTabulationProblem.solver_config.checkpointFile;
+    try {
+      writeCheckpoint(path, phase);
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Wrote checkpoint " << path);
+    } catch (const std::exception &e) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, ERROR)
+                    << "Could not write checkpoint " << path << ": "
+                    << e.what());
+    }
+    NextCheckpoint =
+        std::chrono::steady_clock::now() +
+        std::chrono::seconds(
+            ideTabulationProblem.solver_config.checkpointInterval);
+    if (TerminationSignalGuard::isPending()) {
+      CheckpointGuard->forwardSignal();
+    }
+  }
+
+  /**
+   * Writes the state of the solver into a checkpoint: the jump functions,
+   * the end summaries, the incoming call edges and the unbalanced return
+   * sites, followed by the pending path edges of Phase I or by the values
+   * and the pending nodes of Phase II(i), depending on the phase.
+   */
+  void writeCheckpoint(const std::string &path, SolverPhase phase) {
+    CheckpointWriter out(path, CheckpointVersion);
+    auto writeN = [&](N n) {
+      out.writeString(ideTabulationProblem.NtoPersistedString(n));
+    };
+    auto writeD = [&](D d) {
+      out.writeString(ideTabulationProblem.DtoPersistedString(d));
+    };
+    auto writeF = [&](const EdgeFunctionPtr<V> &f) {
+      out.writeString(
+          ideTabulationProblem.edgeFunctionToPersistedString(f.get()));
+    };
+    out.writeInt(static_cast<uint64_t>(phase));
+    out.writeInt(PathEdgeCount);
+    uint64_t count = 0;
+    jumpFn->foreachFunction([&](D, N, D, const EdgeFunctionPtr<V> &) {
+      ++count;
+    });
+    out.writeInt(count);
+    jumpFn->foreachFunction([&](D sourceVal, N target, D targetVal,
+                                const EdgeFunctionPtr<V> &f) {
+      writeD(sourceVal);
+      writeN(target);
+      writeD(targetVal);
+      writeF(f);
+    });
+    count = 0;
+    for (const auto &summaries : endsummarytab) {
+      count += summaries.v.size();
+    }
+    out.writeInt(count);
+    for (const auto &summaries : endsummarytab) {
+      for (const auto &summary : summaries.v) {
+        writeN(summaries.r);
+        writeD(summaries.c);
+        writeN(summary.r);
+        writeD(summary.c);
+        writeF(summary.v);
+      }
+    }
+    count = 0;
+    for (const auto &callers : incomingtab) {
+      for (const auto &callSite : callers.v) {
+        count += callSite.second.size();
+      }
+    }
+    out.writeInt(count);
+    for (const auto &callers : incomingtab) {
+      for (const auto &callSite : callers.v) {
+        for (D d : callSite.second) {
+          writeN(callers.r);
+          writeD(callers.c);
+          writeN(callSite.first);
+          writeD(d);
+        }
+      }
+    }
+    out.writeInt(unbalancedRetSites.size());
+    for (N n : unbalancedRetSites) {
+      writeN(n);
+    }
+    if (phase == SolverPhase::ExplodedSuperGraph) {
+      std::vector<PathEdge<N, D>> pending;
+      auto addPending = [&pending](const PathEdge<N, D> &edge) {
+        pending.push_back(edge);
+      };
+      if (ConcurrentWorkList) {
+        ConcurrentWorkList->foreachItem(addPending);
+      } else {
+        WorkList.foreachEdge(addPending);
+      }
+      out.writeInt(pending.size());
+      for (auto &edge : pending) {
+        writeD(edge.factAtSource());
+        writeN(edge.getTarget());
+        writeD(edge.factAtTarget());
+      }
+    } else {
+      out.writeInt(valtab.size());
+      for (const auto &cell : valtab) {
+        writeN(cell.r);
+        writeD(cell.c);
+        out.writeString(ideTabulationProblem.VtoPersistedString(cell.v));
+      }
+      std::vector<std::pair<N, D>> pending(ValueWorkList);
+      if (ConcurrentValueWorkList) {
+        ConcurrentValueWorkList->foreachItem(
+            [&pending](const std::pair<N, D> &nAndD) {
+              pending.push_back(nAndD);
+            });
+      }
+      out.writeInt(pending.size());
+      for (const auto &nAndD : pending) {
+        writeN(nAndD.first);
+        writeD(nAndD.second);
+      }
+    }
+    out.commit();
+  }
+
+  /**
+   * Restores the state of the solver from a checkpoint that has been
+   * written by writeCheckpoint() and returns its phase. The pending path
+   * edges or nodes are scheduled again.
+   */
+  SolverPhase readCheckpoint(const std::string &path) {
+    CheckpointReader in(path, CheckpointVersion);
+    // equal strings are converted only once, which also shares the edge
+    // functions that have been shared by the checkpointed solver
+    std::unordered_map<std::string, N> nodes;
+    std::unordered_map<std::string, D> facts;
+    std::unordered_map<std::string, EdgeFunctionPtr<V>> functions;
+    auto lookup = [&in](auto &cache, auto convert) {
+      const std::string &s = in.readString();
+      auto search = cache.find(s);
+      if (search == cache.end()) {
+        search = cache.emplace(s, convert(s)).first;
+      }
+      return search->second;
+    };
+    auto readN = [&]() {
+      return lookup(nodes, [this](const std::string &s) {
+        return ideTabulationProblem.persistedStringToN(s);
+      });
+    };
+    auto readD = [&]() {
+      return lookup(facts, [this](const std::string &s) {
+        return ideTabulationProblem.persistedStringToD(s);
+      });
+    };
+    auto readF = [&]() {
+      return lookup(functions, [this](const std::string &s) {
+        return ideTabulationProblem.persistedStringToEdgeFunction(s);
+      });
+    };
+    uint64_t phase = in.readInt();
+    if (phase != static_cast<uint64_t>(SolverPhase::ExplodedSuperGraph) &&
+        phase != static_cast<uint64_t>(SolverPhase::ValuePropagation)) {
+      throw std::ios_base::failure("corrupt checkpoint: " + path);
+    }
+    PathEdgeCount = in.readInt();
+    for (uint64_t count = in.readInt(); count > 0; --count) {
+      D sourceVal = readD();
+      N target = readN();
+      D targetVal = readD();
+      jumpFn->addFunction(sourceVal, target, targetVal, readF());
+    }
+    for (uint64_t count = in.readInt(); count > 0; --count) {
+      N sP = readN();
+      D d1 = readD();
+      N eP = readN();
+      D d2 = readD();
+      addEndSummary(sP, d1, eP, d2, readF());
+    }
+    for (uint64_t count = in.readInt(); count > 0; --count) {
+      N sP = readN();
+      D d3 = readD();
+      N n = readN();
+      addIncoming(sP, d3, n, readD());
+    }
+    for (uint64_t count = in.readInt(); count > 0; --count) {
+      unbalancedRetSites.insert(readN());
+    }
+    if (phase == static_cast<uint64_t>(SolverPhase::ExplodedSuperGraph)) {
+      for (uint64_t count = in.readInt(); count > 0; --count) {
+        D d1 = readD();
+        N n = readN();
+        schedule(PathEdge<N, D>(d1, n, readD()));
+      }
+      return SolverPhase::ExplodedSuperGraph;
+    }
+    for (uint64_t count = in.readInt(); count > 0; --count) {
+      N n = readN();
+      D d = readD();
+      setVal(n, d, ideTabulationProblem.persistedStringToV(in.readString()));
+    }
+    for (uint64_t count = in.readInt(); count > 0; --count) {
+      N n = readN();
+      D d = readD();
+      if (ConcurrentValueWorkList) {
+        ConcurrentValueWorkList->push(std::make_pair(n, d));
+      } else {
+        ValueWorkList.push_back(std::make_pair(n, d));
+      }
+    }
+    return SolverPhase::ValuePropagation;
+  }
+
+  /**
+   * Adds the given statements and all nodes that may reach one of them in
+   * the interprocedural control-flow graph to the relevant nodes. Methods
+   * that are called on the way are relevant as a whole, since their
+   * summaries are needed at the return sites.
+   */
+  void addRelevantNodes(const std::set<N> &stmts) {
+    std::vector<N> nodes(stmts.begin(), stmts.end());
+    std::vector<M> methods;
+    while (!nodes.empty() || !methods.empty()) {
+      if (!methods.empty()) {
+        M method = methods.back();
+        methods.pop_back();
+        if (!RelevantMethods.insert(method).second) {
+          continue;
+        }
+        for (N sP : icfg.getStartPointsOf(method)) {
+          nodes.push_back(sP);
+        }
+        for (N call : icfg.getCallsFromWithin(method)) {
+          for (M callee : icfg.getCalleesOfCallAt(call)) {
+            methods.push_back(callee);
+          }
+        }
+        continue;
+      }
+      N n = nodes.back();
+      nodes.pop_back();
+      if (!RelevantNodes.insert(n).second) {
+        continue;
+      }
+      for (N pred : icfg.getPredsOf(n)) {
+        if (icfg.isCallStmt(pred)) {
+          for (M callee : icfg.getCalleesOfCallAt(pred)) {
+            methods.push_back(callee);
+          }
+        }
+        nodes.push_back(pred);
+      }
+      // facts flow into a method at its call sites
+      if (icfg.isStartPoint(n)) {
+        for (N caller : icfg.getCallersOf(icfg.getMethodOf(n))) {
+          nodes.push_back(caller);
+        }
+      }
+    }
+  }
+
+  bool isRelevant(N n) {
+    return RelevantNodes.count(n) ||
+           RelevantMethods.count(icfg.getMethodOf(n));
+  }
+
+  /**
+   * Schedules the deferred path edges whose target nodes have become
+   * relevant, or all of them if the solver is no longer demand-driven.
+   */
+  void releaseDeferredEdges() {
+    for (auto it = DeferredEdges.begin(); it != DeferredEdges.end();) {
+      if (Demanding && !isRelevant(it->first)) {
+        ++it;
+        continue;
+      }
+      for (const auto &facts : it->second) {
+        schedule(PathEdge<N, D>(facts.first, it->first, facts.second));
+      }
+      it = DeferredEdges.erase(it);
+    }
+  }
+
+  /**
+   * Adds the given path edge to the work list of Phase I.
+   */
+  void schedule(PathEdge<N, D> edge) {
+    PAMM_GET_INSTANCE;
+    if (ConcurrentWorkList) {
+      ConcurrentWorkList->push(edge);
+    } else if (!WorkList.push(edge, icfg.getMethodOf(edge.getTarget()),
+                              schedulingPriority(edge.getTarget()))) {
+      // the edge is still pending and will be processed only once
+      INC_COUNTER("Path Edges Coalesced", 1, PAMM_SEVERITY_LEVEL::Full);
+    }
+  }
+
+  /**
+   * Asks the problem whether the solver should stop after the given path
+   * edge has been processed.
+   */
+  bool reachedTermination(PathEdge<N, D> edge) {
+    if (!ideTabulationProblem.shouldTerminate(edge.getTarget(),
+                                              edge.factAtTarget())) {
+      return false;
+    }
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Problem requested termination at "
+                  << ideTabulationProblem.NtoString(edge.getTarget()));
+    TerminatedEarly = true;
+    return true;
+  }
+
+  /**
+   * Composes the edge functions F and G, reusing the result of an earlier
+   * composition of the same functions if possible. Compositions with
+   * trivial edge functions are computed directly.
+   */
+  EdgeFunctionPtr<V> compose(const EdgeFunctionPtr<V> &F,
+                             const EdgeFunctionPtr<V> &G) {
+    if (F.isShared() && G.isShared()) {
+      return EFMemo.compose(F.get(), G.get());
+    }
+    return F.composeWith(G);
+  }
+
+  /**
+   * Joins the edge functions F and G, reusing the result of an earlier
+   * join of the same functions if possible. Joins with trivial edge
+   * functions are computed directly.
+   */
+  EdgeFunctionPtr<V> join(const EdgeFunctionPtr<V> &F,
+                          const EdgeFunctionPtr<V> &G) {
+    if (F.isShared() && G.isShared()) {
+      return EFMemo.join(F.get(), G.get());
+    }
+    return F.joinWith(G);
+  }
+
+  /**
+   * Returns the priority of path edges with the given target node for the
+   * ordered work list strategies: exit nodes come first if requested, the
+   * remaining nodes are ordered by their reverse post-order index within
+   * their method. Nodes that cannot be reached from a start point of their
+   * method come last.
+   */
+  size_t schedulingPriority(N n) {
+    WorkListStrategy Strategy = WorkList.getStrategy();
+    if (Strategy != WorkListStrategy::ReversePostOrder &&
+        Strategy != WorkListStrategy::ExitFirst) {
+      return 0;
+    }
+    if (Strategy == WorkListStrategy::ExitFirst && icfg.isExitStmt(n)) {
+      return 0;
+    }
+    M Method = icfg.getMethodOf(n);
+    if (OrderedMethods.insert(Method).second) {
+      computeReversePostOrder(Method);
+    }
+    auto Search = NodeOrder.find(n);
+    return Search != NodeOrder.end() ? Search->second + 1
+                                     : std::numeric_limits<size_t>::max();
+  }
+
+  void computeReversePostOrder(M Method) {
+    // iterative depth-first search, the stack holds the nodes together with
+    // their successors that have not been visited yet
+    std::vector<N> PostOrder;
+    std::unordered_set<N> Visited;
+    std::vector<std::pair<N, std::vector<N>>> Stack;
+    for (N sP : icfg.getStartPointsOf(Method)) {
+      if (!Visited.insert(sP).second) {
+        continue;
+      }
+      Stack.emplace_back(sP, icfg.getSuccsOf(sP));
+      while (!Stack.empty()) {
+        if (Stack.back().second.empty()) {
+          PostOrder.push_back(Stack.back().first);
+          Stack.pop_back();
+          continue;
+        }
+        N Succ = Stack.back().second.back();
+        Stack.back().second.pop_back();
+        if (Visited.insert(Succ).second) {
+          Stack.emplace_back(Succ, icfg.getSuccsOf(Succ));
+        }
+      }
+    }
+    for (size_t Idx = 0; Idx < PostOrder.size(); ++Idx) {
+      NodeOrder[PostOrder[PostOrder.size() - 1 - Idx]] = Idx;
+    }
+  }
+
+  std::unique_lock<std::mutex> lockIfConcurrent(std::mutex &Mtx) {
+    return NumThreads > 1 ? std::unique_lock<std::mutex>(Mtx)
+                          : std::unique_lock<std::mutex>();
+  }
+
+  /**
+   * Returns whether fact d can be propagated past node n without evaluating
+   * the flow and edge functions of n.
+   * @see SolverConfiguration::sparsePropagation
+   */
+  bool isSkippable(N n, D d) {
+    return ideTabulationProblem.solver_config.sparsePropagation &&
+           !icfg.isCallStmt(n) && !icfg.isExitStmt(n) &&
+           !ideTabulationProblem.mayAffect(n, d);
+  }
+
+  /**
+   * Returns the only successor of n if n is its only predecessor, such that
+   * the values at the successor only depend on the values at n.
+   */
+  std::optional<N> chainSuccessor(N n) {
+    std::vector<N> succs = icfg.getSuccsOf(n);
+    if (succs.size() != 1 || icfg.getPredsOf(succs.front()).size() != 1) {
+      return std::nullopt;
+    }
+    return succs.front();
+  }
+
+  /**
+   * Returns the only predecessor of n if n is its only successor.
+   * @see chainSuccessor()
+   */
+  std::optional<N> chainPredecessor(N n) {
+    std::vector<N> preds = icfg.getPredsOf(n);
+    if (preds.size() != 1 || icfg.getSuccsOf(preds.front()).size() != 1) {
+      return std::nullopt;
+    }
+    return preds.front();
+  }
+
+  /**
+   * Returns the last node of the chain of nodes that starts at n, is linked
+   * by chainSuccessor() and does not affect fact d. The chain's end is
+   * computed once per node and fact.
+   */
+  N skipChainEnd(N n, D d) {
+    {
+      auto Lock = lockIfConcurrent(SkipChainMtx);
+      if (const N *End = SkipChainEnds.find(std::make_tuple(n, d))) {
+        return *End;
+      }
+    }
+    N End = n;
+    for (auto m = chainSuccessor(n); m && *m != n && isSkippable(*m, d);
+         m = chainSuccessor(*m)) {
+      End = *m;
+    }
+    auto Lock = lockIfConcurrent(SkipChainMtx);
+    SkipChainEnds.insert(std::make_tuple(n, d), End);
+    return End;
+  }
+
+  /**
+   * Propagates the fact at the target of the given edge past the chain of
+   * nodes that follows the target and does not affect the fact. Only the
+   * chain's last node receives a jump function and only its successors are
+   * scheduled; the nodes in between are neither processed nor recorded, their
+   * values are filled in from their predecessors in Phase II, see
+   * computeChainValues().
+   */
+  void skipUnaffectedNodes(PathEdge<N, D> edge) {
+    PAMM_GET_INSTANCE;
+    D d1 = edge.factAtSource();
+    D d2 = edge.factAtTarget();
+    // the normal flow and edge functions of skippable nodes are identities
+    EdgeFunctionPtr<V> f = jumpFunction(edge);
+    N n = skipChainEnd(edge.getTarget(), d2);
+    if (n != edge.getTarget()) {
+      bool knownEdge;
+      f = joinIntoJumpFunction(d1, n, d2, f, knownEdge);
+      if (!f) {
+        // the successors of the chain are up to date already
+        return;
+      }
+      PathEdgeCount.fetch_add(1, std::memory_order_relaxed);
+      INC_COUNTER("Path Edges Skipped", 1, PAMM_SEVERITY_LEVEL::Full);
+    }
+    for (N m : icfg.getSuccsOf(n)) {
+      saveEdges(n, m, d2, {d2}, false);
+      propagate(d1, m, d2, f, nullptr, false);
+    }
+  }
+
   // should be made a callable at some point
   void pathEdgeProcessingTask(PathEdge<N, D> edge) {
     PAMM_GET_INSTANCE;
@@ -743,7 +1770,11 @@ protected:
         processExit(edge);
       }
       if (!icfg.getSuccsOf(edge.getTarget()).empty()) {
-        processNormalFlow(edge);
+        if (isSkippable(edge.getTarget(), edge.factAtTarget())) {
+          skipUnaffectedNodes(edge);
+        } else {
+          processNormalFlow(edge);
+        }
       }
     } else {
       processCall(edge);
@@ -770,20 +1801,40 @@ protected:
     PAMM_GET_INSTANCE;
     for (N n : values) {
       for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
-        Table<D, D, std::shared_ptr<EdgeFunction<V>>> lookupByTarget;
-        lookupByTarget = jumpFn->lookupByTarget(n);
-        for (typename Table<D, D, std::shared_ptr<EdgeFunction<V>>>::Cell
-                 sourceValTargetValAndFunction : lookupByTarget.cellSet()) {
-          D dPrime = sourceValTargetValAndFunction.getRowKey();
-          D d = sourceValTargetValAndFunction.getColumnKey();
-          std::shared_ptr<EdgeFunction<V>> fPrime =
-              sourceValTargetValAndFunction.getValue();
-          V targetVal = val(sP, dPrime);
-          setVal(n, d,
-                 ideTabulationProblem.join(val(n, d),
-                                           fPrime->computeTarget(targetVal)));
-          INC_COUNTER("Value Computation", 1, PAMM_SEVERITY_LEVEL::Full);
-        }
+        jumpFn->lookupByTargetView(n).foreachCell(
+            [&](D dPrime, D d, const EdgeFunctionPtr<V> &fPrime) {
+              V targetVal = val(sP, dPrime);
+              setVal(n, d,
+                     ideTabulationProblem.join(
+                         val(n, d), fPrime.computeTarget(targetVal)));
+              INC_COUNTER("Value Computation", 1, PAMM_SEVERITY_LEVEL::Full);
+            });
+      }
+    }
+  }
+
+  /**
+   * Same as valueComputationTask(), but writes the values into the given
+   * thread-local table rather than into valtab. Since each node is handled
+   * by exactly one task, the local tables can simply be copied into valtab
+   * afterwards.
+   */
+  void valueComputationTask(const std::vector<N> &values, size_t Begin,
+                            size_t End, FlatTable<N, D, V> &LocalValues) {
+    PAMM_GET_INSTANCE;
+    for (size_t Idx = Begin; Idx < End; ++Idx) {
+      N n = values[Idx];
+      for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
+        jumpFn->lookupByTargetView(n).foreachCell(
+            [&](D dPrime, D d, const EdgeFunctionPtr<V> &fPrime) {
+              V targetVal = val(sP, dPrime);
+              const V *Local = LocalValues.find(n, d);
+              V current = Local ? *Local : val(n, d);
+              setVal(LocalValues, n, d,
+                     ideTabulationProblem.join(
+                         current, fPrime.computeTarget(targetVal)));
+              INC_COUNTER("Value Computation", 1, PAMM_SEVERITY_LEVEL::Full);
+            });
       }
     }
   }
@@ -796,25 +1847,92 @@ protected:
   bool followReturnPastSeeds;
   bool computePersistedSummaries;
   bool recordEdges;
-  unsigned PathEdgeCount;
+  std::atomic<unsigned> PathEdgeCount;
+  std::atomic<bool> TerminatedEarly{false};
+
+  // path edges that still have to be processed in Phase I
+  PathEdgeWorkList<N, D, M> WorkList;
+  // reverse post-order indices of the nodes of the methods in OrderedMethods,
+  // only computed for the ordered work list strategies
+  std::unordered_map<N, size_t> NodeOrder;
+  std::unordered_set<M> OrderedMethods;
+
+  // state of the demand-driven mode, see solveFor(): only path edges whose
+  // target node may reach one of the queried statements are processed, all
+  // other path edges are deferred until a later query requires them
+  bool Demanding = false;
+  bool ExhaustivelySolved = false;
+  std::unordered_set<N> RelevantNodes;
+  std::unordered_set<M> RelevantMethods;
+  std::unordered_map<N, std::set<std::pair<D, D>>> DeferredEdges;
+  std::mutex DeferredEdgesMtx;
+  std::set<N> QueriedNodes;
+  // number of path edges the values of the queried statements are based on
+  unsigned PathEdgeCountAtValues = 0;
+  bool ValuesPropagated = false;
+  // jump functions at call sites that have changed since the values have
+  // been propagated last, see propagateChangedValues()
+  std::vector<std::tuple<D, N, D>> ChangedCallJumpFns;
+  std::mutex ChangedCallJumpFnsMtx;
+  // nodes whose values have been computed lazily; guarded by LazyValuesMtx
+  // along with the values that are added to valtab lazily
+  std::unordered_set<N> NodesWithValues;
+  std::mutex LazyValuesMtx;
+
+  // checkpoints are taken while the guard is alive, see
+  // SolverConfiguration::checkpointFile
+  std::unique_ptr<TerminationSignalGuard> CheckpointGuard;
+  std::chrono::steady_clock::time_point NextCheckpoint;
+  std::atomic<unsigned> CheckpointPolls{0};
+
+  // Phase I is run by NumThreads workers that share the ConcurrentWorkList
+  // if more than one thread has been requested. In that case the
+  // propagation of path edges is serialized per target node using
+  // PropagationMtxs, and the end-summary and incoming tables are guarded by
+  // SummaryMtx.
+  static constexpr size_t NumLockStripes = 64;
+  unsigned NumThreads;
+  std::unique_ptr<WorkStealingQueue<PathEdge<N, D>>> ConcurrentWorkList;
+  std::vector<std::mutex> PropagationMtxs;
+  // nodes whose values have to be propagated further in Phase II(i); the
+  // values themselves are guarded by ValtabMtx in multi-threaded mode, their
+  // updates are serialized per node using ValuePropagationMtxs
+  std::vector<std::pair<N, D>> ValueWorkList;
+  std::unique_ptr<WorkStealingQueue<std::pair<N, D>>> ConcurrentValueWorkList;
+  std::vector<std::mutex> ValuePropagationMtxs;
+  std::shared_mutex ValtabMtx;
+  std::mutex SummaryMtx;
+  std::mutex RecordedEdgesMtx;
+  std::mutex UnbalancedRetSitesMtx;
 
   FlowEdgeFunctionCache<N, D, M, V, I> cachedFlowEdgeFunctions;
+  // the flow-function targets of the batch of path edges that is currently
+  // processed by the single-threaded work list, see batchFlowTargets()
+  FlatHashMap<std::tuple<FlowFunction<D> *, D>, FFSet<D>, TupleHash>
+      BatchTargets;
+  std::vector<std::shared_ptr<FlowFunction<D>>> BatchFunctions;
+  // the ends of the chains of skippable nodes, see skipChainEnd()
+  FlatHashMap<std::tuple<N, D>, N, TupleHash> SkipChainEnds;
+  std::mutex SkipChainMtx;
 
-  Table<N, N, std::map<D, std::set<D>>> computedIntraPathEdges;
+  // canonical edge functions and memoized compositions and joins
+  EdgeFunctionMemo<V> EFMemo;
 
-  Table<N, N, std::map<D, std::set<D>>> computedInterPathEdges;
+  FlatTable<N, N, std::map<D, std::set<D>>> computedIntraPathEdges;
 
-  std::shared_ptr<EdgeFunction<V>> allTop;
+  FlatTable<N, N, std::map<D, std::set<D>>> computedInterPathEdges;
+
+  EdgeFunctionPtr<V> allTop;
 
   std::shared_ptr<JumpFunctions<N, D, M, V, I>> jumpFn;
 
   // stores summaries that were queried before they were computed
   // see CC 2010 paper by Naeem, Lhotak and Rodriguez
-  Table<N, D, Table<N, D, std::shared_ptr<EdgeFunction<V>>>> endsummarytab;
+  FlatTable<N, D, FlatTable<N, D, EdgeFunctionPtr<V>>> endsummarytab;
 
   // edges going along calls
   // see CC 2010 paper by Naeem, Lhotak and Rodriguez
-  Table<N, D, std::map<N, std::set<D>>> incomingtab;
+  FlatTable<N, D, std::map<N, std::set<D>>> incomingtab;
 
   // stores the return sites (inside callers) to which we have unbalanced
   // returns if followReturnPastSeeds is enabled
@@ -822,7 +1940,7 @@ protected:
 
   std::map<N, std::set<D>> initialSeeds;
 
-  Table<N, D, V> valtab;
+  FlatTable<N, D, V> valtab;
 
   std::map<std::pair<N, D>, size_t> fSummaryReuse;
 
@@ -846,21 +1964,36 @@ protected:
         computePersistedSummaries(
             ideTabulationProblem.solver_config.computePersistedSummaries),
         recordEdges(ideTabulationProblem.solver_config.recordEdges),
-        PathEdgeCount(0), cachedFlowEdgeFunctions(ideTabulationProblem),
+        PathEdgeCount(0),
+        WorkList(ideTabulationProblem.solver_config.workListStrategy),
+        NumThreads(ideTabulationProblem.solver_config.numThreads),
+        PropagationMtxs(NumThreads > 1 ? NumLockStripes : 1),
+        ValuePropagationMtxs(NumThreads > 1 ? NumLockStripes : 1),
+        cachedFlowEdgeFunctions(ideTabulationProblem),
+        EFMemo(ideTabulationProblem.solver_config.edgeFunctionMemoSize,
+               NumThreads > 1),
         allTop(ideTabulationProblem.allTopFunction()),
         jumpFn(std::make_shared<JumpFunctions<N, D, M, V, I>>(
-            allTop, ideTabulationProblem)),
+            allTop, ideTabulationProblem,
+            NumThreads > 1 ? NumLockStripes : 1)),
         initialSeeds(ideTabulationProblem.initialSeeds()) {
+    if (NumThreads > 1) {
+      ConcurrentWorkList =
+          std::make_unique<WorkStealingQueue<PathEdge<N, D>>>(NumThreads);
+      ConcurrentValueWorkList =
+          std::make_unique<WorkStealingQueue<std::pair<N, D>>>(NumThreads);
+    }
     // std::cout << "called IDESolver::IDESolver() ctor with IFDSProblem" <<
     // std::endl;
   }
 
   virtual void saveEdges(N sourceNode, N sinkStmt, D sourceVal,
-                         std::set<D> destVals, bool interP) {
+                         const FFSet<D> &destVals, bool interP) {
     if (!recordEdges)
       return;
-    Table<N, N, std::map<D, std::set<D>>> &tgtMap =
+    FlatTable<N, N, std::map<D, std::set<D>>> &tgtMap =
         (interP) ? computedInterPathEdges : computedIntraPathEdges;
+    auto Lock = lockIfConcurrent(RecordedEdgesMtx);
     tgtMap.get(sourceNode, sinkStmt)[sourceVal].insert(destVals.begin(),
                                                        destVals.end());
   }
@@ -872,6 +2005,164 @@ protected:
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start computing values");
     // Phase II(i)
+    propagateValuesFromSeeds();
+    computeNonCallStartValues();
+  }
+
+  /**
+   * Phase II(ii) of the algorithm; computes the values at all nodes that are
+   * neither call sites nor start points.
+   */
+  void computeNonCallStartValues() {
+    if (ideTabulationProblem.solver_config.lazyValueComputation) {
+      // Phase II(ii) is performed per node once its values are queried
+      return;
+    }
+    // Phase II(ii)
+    // we create an array of all nodes and then dispatch fractions of this array
+    // to multiple threads
+    std::set<N> allNonCallStartNodes = icfg.allNonCallStartNodes();
+    std::vector<N> nonCallStartNodesArray(allNonCallStartNodes.size());
+    size_t i = 0;
+    for (N n : allNonCallStartNodes) {
+      nonCallStartNodesArray[i] = n;
+      i++;
+    }
+    if (NumThreads <= 1) {
+      valueComputationTask(nonCallStartNodesArray);
+      computeSkippedValues(nonCallStartNodesArray);
+      return;
+    }
+    // valtab is only read by the workers, each of which writes the values of
+    // its fraction of nodes into a table of its own
+    std::vector<FlatTable<N, D, V>> LocalValtabs(NumThreads);
+    std::vector<std::thread> Workers;
+    size_t NumNodes = nonCallStartNodesArray.size();
+    for (size_t Worker = 0; Worker < NumThreads; ++Worker) {
+      Workers.emplace_back([this, &nonCallStartNodesArray, &LocalValtabs,
+                            NumNodes, Worker]() {
+        valueComputationTask(nonCallStartNodesArray,
+                             NumNodes * Worker / NumThreads,
+                             NumNodes * (Worker + 1) / NumThreads,
+                             LocalValtabs[Worker]);
+      });
+    }
+    for (auto &Worker : Workers) {
+      Worker.join();
+    }
+    for (auto &LocalValtab : LocalValtabs) {
+      for (auto &cell : LocalValtab) {
+        valtab.insert(cell.r, cell.c, cell.v);
+      }
+    }
+    computeSkippedValues(nonCallStartNodesArray);
+  }
+
+  /**
+   * Completes the values of the given nodes, whose values have been computed
+   * from their jump functions already, with the facts that sparse
+   * propagation has carried past them.
+   */
+  void computeSkippedValues(const std::vector<N> &nodes) {
+    if (!ideTabulationProblem.solver_config.sparsePropagation) {
+      return;
+    }
+    std::unordered_set<N> Done;
+    for (N n : nodes) {
+      if (!Done.count(n)) {
+        computeChainValues(n, Done, valtab, false);
+      }
+    }
+  }
+
+  /**
+   * Phase II(ii) for node n and the nodes of the chain that precedes it, see
+   * chainPredecessor(). Sparse propagation carries facts past such chains
+   * without adding jump functions to their nodes, see skipUnaffectedNodes(),
+   * hence the values of these facts are passed down the chain starting at
+   * the last predecessor whose values are complete. If computeDirect is set,
+   * the values of the nodes on the way are computed from their jump
+   * functions first. The nodes whose values are complete are added to Done.
+   */
+  void computeChainValues(N n, std::unordered_set<N> &Done,
+                          FlatTable<N, D, V> &Values, bool computeDirect) {
+    auto isDone = [&](N m) {
+      return icfg.isCallStmt(m) || icfg.isStartPoint(m) || Done.count(m) ||
+             NodesWithValues.count(m);
+    };
+    std::vector<N> chain{n};
+    std::optional<N> head = chainPredecessor(n);
+    if (ideTabulationProblem.solver_config.sparsePropagation) {
+      while (head && *head != n && !isDone(*head)) {
+        chain.push_back(*head);
+        head = chainPredecessor(*head);
+      }
+      std::reverse(chain.begin(), chain.end());
+    }
+    if (computeDirect) {
+      valueComputationTask(chain, 0, chain.size(), Values);
+    }
+    if (ideTabulationProblem.solver_config.sparsePropagation) {
+      if (head && *head != n && isDone(*head)) {
+        joinSkippedValues(*head, chain.front(), Values);
+      }
+      for (size_t Idx = 1; Idx < chain.size(); ++Idx) {
+        joinSkippedValues(chain[Idx - 1], chain[Idx], Values);
+      }
+    }
+    Done.insert(chain.begin(), chain.end());
+  }
+
+  /**
+   * Joins the values of the facts that sparse propagation has carried from
+   * node p to its chain successor q into the values of q.
+   */
+  void joinSkippedValues(N p, N q, FlatTable<N, D, V> &Values) {
+    const FlatTable<N, D, V> &From = Values.containsRow(p) ? Values : valtab;
+    std::vector<std::pair<D, V>> skipped;
+    From.foreachInRow(p, [&](D d, const V &v) {
+      if (isSkippable(p, d) && isSkippable(q, d)) {
+        skipped.emplace_back(d, v);
+      }
+    });
+    for (const auto &dAndV : skipped) {
+      const V *Local = Values.find(q, dAndV.first);
+      V current = Local ? *Local : val(q, dAndV.first);
+      setVal(Values, q, dAndV.first,
+             ideTabulationProblem.join(current, dAndV.second));
+    }
+  }
+
+  bool hasLazyValues() {
+    return ideTabulationProblem.solver_config.lazyValueComputation &&
+           ExhaustivelySolved && computevalues && !TerminatedEarly;
+  }
+
+  /**
+   * Phase II(ii) for a single node if the values are computed lazily; the
+   * values of each node are computed once, when they are first queried.
+   * Since results may be queried from several threads, the values are added
+   * to valtab under LazyValuesMtx, which is returned locked such that the
+   * caller can read them before another query modifies valtab.
+   */
+  std::unique_lock<std::mutex> computeValuesAt(N n) {
+    if (!hasLazyValues()) {
+      return std::unique_lock<std::mutex>();
+    }
+    std::unique_lock<std::mutex> Lock(LazyValuesMtx);
+    if (!icfg.isCallStmt(n) && !icfg.isStartPoint(n) &&
+        !NodesWithValues.count(n)) {
+      computeChainValues(n, NodesWithValues, valtab, true);
+    }
+    return Lock;
+  }
+
+  /**
+   * Phase II(i) of the algorithm; computes the values at the start points
+   * and call sites by propagating the values of the seeds along the jump
+   * functions.
+   */
+  void propagateValuesFromSeeds() {
     std::map<N, std::set<D>> allSeeds(initialSeeds);
     for (N unbalancedRetSite : unbalancedRetSites) {
       if (allSeeds[unbalancedRetSite].empty()) {
@@ -884,24 +2175,62 @@ protected:
       for (D val : seed.second) {
         setVal(startPoint, val, ideTabulationProblem.bottomElement());
         std::pair<N, D> superGraphNode(startPoint, val);
-        valuePropagationTask(superGraphNode);
+        if (ConcurrentValueWorkList) {
+          ConcurrentValueWorkList->push(superGraphNode);
+        } else {
+          ValueWorkList.push_back(superGraphNode);
+        }
       }
     }
-    // Phase II(ii)
-    // we create an array of all nodes and then dispatch fractions of this array
-    // to multiple threads
-    std::set<N> allNonCallStartNodes = icfg.allNonCallStartNodes();
-    std::vector<N> nonCallStartNodesArray(allNonCallStartNodes.size());
-    size_t i = 0;
-    for (N n : allNonCallStartNodes) {
-      nonCallStartNodesArray[i] = n;
-      i++;
+    runValueWorkList();
+  }
+
+  /**
+   * Phase II(i) in the demand-driven mode after the exploded super graph has
+   * grown since the values have been propagated last, see solveFor(). The
+   * values in valtab are kept and only those of new seeds and of the call
+   * sites whose jump functions have changed are propagated further.
+   */
+  void propagateChangedValues() {
+    std::map<N, std::set<D>> allSeeds(initialSeeds);
+    for (N unbalancedRetSite : unbalancedRetSites) {
+      if (allSeeds[unbalancedRetSite].empty()) {
+        allSeeds[unbalancedRetSite].insert(zeroValue);
+      }
     }
-    valueComputationTask(nonCallStartNodesArray);
+    for (const auto &seed : allSeeds) {
+      for (D val : seed.second) {
+        propagateValue(seed.first, val, ideTabulationProblem.bottomElement());
+      }
+    }
+    std::vector<std::tuple<D, N, D>> changed;
+    changed.swap(ChangedCallJumpFns);
+    for (const auto &jumpFnKey : changed) {
+      D sourceVal = std::get<0>(jumpFnKey);
+      N c = std::get<1>(jumpFnKey);
+      D targetVal = std::get<2>(jumpFnKey);
+      EdgeFunctionPtr<V> f = jumpFn->getFunction(sourceVal, c, targetVal);
+      M p = icfg.getMethodOf(c);
+      // the sources of the jump functions are the start points, and the
+      // seeds and unbalanced return sites within the method
+      std::set<N> sources = icfg.getStartPointsOf(p);
+      for (const auto &seed : allSeeds) {
+        if (icfg.getMethodOf(seed.first) == p) {
+          sources.insert(seed.first);
+        }
+      }
+      for (N sP : sources) {
+        if (const V *value = valtab.find(sP, sourceVal)) {
+          propagateValue(c, targetVal, f.computeTarget(*value));
+        }
+      }
+    }
+    runValueWorkList();
   }
 
   /**
-   * Schedules the processing of initial seeds, initiating the analysis.
+   * Schedules the processing of initial seeds, initiating the analysis, and
+   * processes the work list until the exploded super graph has been built.
    * Clients should only call this methods if performing synchronization on
    * their own. Normally, solve() should be called instead.
    */
@@ -921,12 +2250,13 @@ protected:
         if (!ideTabulationProblem.isZeroValue(value)) {
           INC_COUNTER("Gen facts", 1, PAMM_SEVERITY_LEVEL::Core);
         }
-        propagate(zeroValue, startPoint, value, EdgeIdentity<V>::getInstance(),
+        propagate(zeroValue, startPoint, value, EdgeFunctionPtr<V>::identity(),
                   nullptr, false);
       }
       jumpFn->addFunction(zeroValue, startPoint, zeroValue,
-                          EdgeIdentity<V>::getInstance());
+                          EdgeFunctionPtr<V>::identity());
     }
+    runWorkList();
   }
 
   /**
@@ -946,23 +2276,26 @@ protected:
                   << "Process exit at target: "
                   << ideTabulationProblem.NtoString(edge.getTarget()));
     N n = edge.getTarget(); // an exit node; line 21...
-    std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
+    EdgeFunctionPtr<V> f = jumpFunction(edge);
     M methodThatNeedsSummary = icfg.getMethodOf(n);
     D d1 = edge.factAtSource();
     D d2 = edge.factAtTarget();
     // for each of the method's start points, determine incoming calls
     std::set<N> startPointsOf = icfg.getStartPointsOf(methodThatNeedsSummary);
     std::map<N, std::set<D>> inc;
-    for (N sP : startPointsOf) {
-      // line 21.1 of Naeem/Lhotak/Rodriguez
-      // register end-summary
-      addEndSummary(sP, d1, n, d2, f);
-      for (auto entry : incoming(d1, sP)) {
-        inc[entry.first] = std::set<D>{entry.second};
+    {
+      auto Lock = lockIfConcurrent(SummaryMtx);
+      for (N sP : startPointsOf) {
+        // line 21.1 of Naeem/Lhotak/Rodriguez
+        // register end-summary
+        addEndSummary(sP, d1, n, d2, f);
+        for (auto entry : incoming(d1, sP)) {
+          inc[entry.first] = std::set<D>{entry.second};
+        }
       }
+      printEndSummaryTab();
+      printIncomingTab();
     }
-    printEndSummaryTab();
-    printIncomingTab();
     // for each incoming call edge already processed
     //(see processCall(..))
     for (auto entry : inc) {
@@ -977,7 +2310,7 @@ protected:
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         // for each incoming-call value
         for (D d4 : entry.second) {
-          std::set<D> targets =
+          FFSet<D> targets =
               computeReturnFlowFunction(retFunction, d1, d2, c, entry.second);
           ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
                            PAMM_SEVERITY_LEVEL::Full);
@@ -987,38 +2320,37 @@ protected:
           for (D d5 : targets) {
             // compute composed function
             // get call edge function
-            std::shared_ptr<EdgeFunction<V>> f4 =
-                cachedFlowEdgeFunctions.getCallEdgeFunction(
-                    c, d4, icfg.getMethodOf(n), d1);
+            EdgeFunctionPtr<V> f4 = cachedFlowEdgeFunctions.getCallEdgeFunction(
+                c, d4, icfg.getMethodOf(n), d1);
             // get return edge function
-            std::shared_ptr<EdgeFunction<V>> f5 =
+            EdgeFunctionPtr<V> f5 =
                 cachedFlowEdgeFunctions.getReturnEdgeFunction(
                     c, icfg.getMethodOf(n), n, d2, retSiteC, d5);
             INC_COUNTER("EF Queries", 2, PAMM_SEVERITY_LEVEL::Full);
             // compose call function * function * return function
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << f5->str() << " * " << f->str()
-                          << " * " << f4->str());
+                          << "Compose: " << f5.str() << " * " << f.str()
+                          << " * " << f4.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                           << "         (return * function * call)");
-            std::shared_ptr<EdgeFunction<V>> fPrime =
-                f4->composeWith(f)->composeWith(f5);
+            EdgeFunctionPtr<V> fPrime = compose(compose(f4, f), f5);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "       = " << fPrime->str());
+                          << "       = " << fPrime.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
             // for each jump function coming into the call, propagate to return
-            // site using the composed function
+            // site using the composed function; this needs a copy since
+            // propagate() adds new jump functions
             for (auto valAndFunc : jumpFn->reverseLookup(c, d4)) {
-              std::shared_ptr<EdgeFunction<V>> f3 = valAndFunc.second;
-              if (!f3->equal_to(allTop)) {
+              EdgeFunctionPtr<V> f3 = valAndFunc.second;
+              if (!f3.equal_to(allTop)) {
                 D d3 = valAndFunc.first;
                 D d5_restoredCtx = restoreContextOnReturnedFact(c, d4, d5);
                 LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                              << "Compose: " << fPrime->str() << " * "
-                              << f3->str());
+                              << "Compose: " << fPrime.str() << " * "
+                              << f3.str());
                 LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-                propagate(d3, retSiteC, d5_restoredCtx, f3->composeWith(fPrime),
-                          c, false);
+                propagate(d3, retSiteC, d5_restoredCtx, compose(f3, fPrime), c,
+                          false);
               }
             }
           }
@@ -1039,21 +2371,22 @@ protected:
               cachedFlowEdgeFunctions.getRetFlowFunction(
                   c, methodThatNeedsSummary, n, retSiteC);
           INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-          std::set<D> targets = computeReturnFlowFunction(
+          FFSet<D> targets = computeReturnFlowFunction(
               retFunction, d1, d2, c, std::set<D>{zeroValue});
           ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
                            PAMM_SEVERITY_LEVEL::Full);
           saveEdges(n, retSiteC, d2, targets, true);
           for (D d5 : targets) {
-            std::shared_ptr<EdgeFunction<V>> f5 =
+            EdgeFunctionPtr<V> f5 =
                 cachedFlowEdgeFunctions.getReturnEdgeFunction(
                     c, icfg.getMethodOf(n), n, d2, retSiteC, d5);
             INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << f5->str() << " * " << f->str());
+                          << "Compose: " << f5.str() << " * " << f.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-            propagteUnbalancedReturnFlow(retSiteC, d5, f->composeWith(f5), c);
+            propagteUnbalancedReturnFlow(retSiteC, d5, compose(f, f5), c);
             // register for value processing (2nd IDE phase)
+            auto Lock = lockIfConcurrent(UnbalancedRetSitesMtx);
             unbalancedRetSites.insert(retSiteC);
           }
         }
@@ -1074,7 +2407,7 @@ protected:
 
   void
   propagteUnbalancedReturnFlow(N retSiteC, D targetVal,
-                               std::shared_ptr<EdgeFunction<V>> edgeFunction,
+                               EdgeFunctionPtr<V> edgeFunction,
                                N relatedCallSite) {
     propagate(zeroValue, retSiteC, targetVal, edgeFunction, relatedCallSite,
               true);
@@ -1112,18 +2445,18 @@ protected:
    * @param d2 The abstraction at the current node
    * @return The set of abstractions at the successor node
    */
-  std::set<D>
+  FFSet<D>
   computeNormalFlowFunction(std::shared_ptr<FlowFunction<D>> flowFunction, D d1,
                             D d2) {
-    return flowFunction->computeTargets(d2);
+    return flowTargets(flowFunction, d2);
   }
 
   /**
    * TODO: comment
    */
-  std::set<D> computeSummaryFlowFunction(
+  FFSet<D> computeSummaryFlowFunction(
       std::shared_ptr<FlowFunction<D>> SummaryFlowFunction, D d1, D d2) {
-    return SummaryFlowFunction->computeTargets(d2);
+    return flowTargets(SummaryFlowFunction, d2);
   }
 
   /**
@@ -1133,10 +2466,10 @@ protected:
    * @param d2 The abstraction at the call site
    * @return The set of caller-side abstractions at the callee's start node
    */
-  std::set<D>
+  FFSet<D>
   computeCallFlowFunction(std::shared_ptr<FlowFunction<D>> callFlowFunction,
                           D d1, D d2) {
-    return callFlowFunction->computeTargets(d2);
+    return flowTargets(callFlowFunction, d2);
   }
 
   /**
@@ -1148,9 +2481,9 @@ protected:
    * @param d2 The abstraction at the call site
    * @return The set of caller-side abstractions at the return site
    */
-  std::set<D> computeCallToReturnFlowFunction(
+  FFSet<D> computeCallToReturnFlowFunction(
       std::shared_ptr<FlowFunction<D>> callToReturnFlowFunction, D d1, D d2) {
-    return callToReturnFlowFunction->computeTargets(d2);
+    return flowTargets(callToReturnFlowFunction, d2);
   }
 
   /**
@@ -1163,10 +2496,10 @@ protected:
    * @param callerSideDs The abstractions at the call site
    * @return The set of caller-side abstractions at the return site
    */
-  std::set<D>
+  FFSet<D>
   computeReturnFlowFunction(std::shared_ptr<FlowFunction<D>> retFunction, D d1,
                             D d2, N callSite, std::set<D> callerSideDs) {
-    return retFunction->computeTargets(d2);
+    return flowTargets(retFunction, d2);
   }
 
   /**
@@ -1187,10 +2520,10 @@ protected:
    * but may be useful for subclasses of {@link IDESolver})
    */
   void
-  propagate(D sourceVal, N target, D targetVal,
-            std::shared_ptr<EdgeFunction<V>> f,
+  propagate(D sourceVal, N target, D targetVal, EdgeFunctionPtr<V> f,
             /* deliberately exposed to clients */ N relatedCallSite,
             /* deliberately exposed to clients */ bool isUnbalancedReturn) {
+    PAMM_GET_INSTANCE;
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Propagate flow");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
@@ -1203,31 +2536,29 @@ protected:
                   << "Target value  : "
                   << ideTabulationProblem.DtoString(targetVal));
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Edge function : " << f.get()->str()
+                  << "Edge function : " << f.str()
                   << " (result of previous compose)");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-    std::shared_ptr<EdgeFunction<V>> jumpFnE = nullptr;
-    std::shared_ptr<EdgeFunction<V>> fPrime;
-    if (!jumpFn->reverseLookup(target, targetVal).empty()) {
-      jumpFnE = jumpFn->reverseLookup(target, targetVal)[sourceVal];
-    }
-    if (jumpFnE == nullptr) {
-      jumpFnE = allTop; // jump function is initialized to all-top
-    }
-    fPrime = jumpFnE->joinWith(f);
-    bool newFunction = !(fPrime->equal_to(jumpFnE));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Join: " << jumpFnE->str() << " & " << f.get()->str()
-                  << (jumpFnE->equal_to(f) ? " (EF's are equal)" : " "));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "    = " << fPrime->str()
-                  << (newFunction ? " (new jump func)" : " "));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-    if (newFunction) {
-      jumpFn->addFunction(sourceVal, target, targetVal, fPrime);
+    bool knownEdge;
+    if (joinIntoJumpFunction(sourceVal, target, targetVal, f, knownEdge)) {
       PathEdge<N, D> edge(sourceVal, target, targetVal);
-      PathEdgeCount++;
-      pathEdgeProcessingTask(edge);
+      PathEdgeCount.fetch_add(1, std::memory_order_relaxed);
+      // the edge is processed later on with the jump function that is
+      // current at that time; this keeps the stack depth independent of the
+      // length of the paths being explored
+      if (knownEdge) {
+        // the edge has to be processed again
+        INC_COUNTER("Path Edge Updates", 1, PAMM_SEVERITY_LEVEL::Full);
+      }
+      if (Demanding && !isRelevant(target)) {
+        // the edge cannot contribute to the queried results, it is processed
+        // once a later query requires it
+        auto DeferredLock = lockIfConcurrent(DeferredEdgesMtx);
+        DeferredEdges[target].emplace(sourceVal, targetVal);
+        INC_COUNTER("Path Edges Deferred", 1, PAMM_SEVERITY_LEVEL::Full);
+      } else {
+        schedule(edge);
+      }
       if (!ideTabulationProblem.isZeroValue(targetVal)) {
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "EDGE: <F: " << target->getFunction()->getName().str()
@@ -1246,11 +2577,52 @@ protected:
     }
   }
 
+  /**
+   * Joins f into the jump function from sourceVal to targetVal at target.
+   * Returns the joined jump function if it has changed, nullptr otherwise.
+   * knownEdge is set if there has been a jump function before.
+   */
+  EdgeFunctionPtr<V>
+  joinIntoJumpFunction(D sourceVal, N target, D targetVal,
+                       EdgeFunctionPtr<V> f, bool &knownEdge) {
+    auto &lg = lg::get();
+    // the lookup, join and update of the jump function must not interleave
+    // with another thread propagating to the same target
+    auto Lock = lockIfConcurrent(
+        PropagationMtxs[shardIndex(target, PropagationMtxs.size())]);
+    EdgeFunctionPtr<V> jumpFnE =
+        jumpFn->getFunction(sourceVal, target, targetVal);
+    EdgeFunctionPtr<V> fPrime;
+    knownEdge = static_cast<bool>(jumpFnE);
+    if (!knownEdge) {
+      jumpFnE = allTop; // jump function is initialized to all-top
+    }
+    fPrime = join(jumpFnE, f);
+    // canonical edge functions can mostly be compared by their address
+    bool newFunction = !fPrime.equal_to(jumpFnE);
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Join: " << jumpFnE.str() << " & " << f.str()
+                  << (jumpFnE.equal_to(f) ? " (EF's are equal)" : " "));
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "    = " << fPrime.str()
+                  << (newFunction ? " (new jump func)" : " "));
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    if (!newFunction) {
+      return nullptr;
+    }
+    jumpFn->addFunction(sourceVal, target, targetVal, fPrime);
+    if (Demanding && icfg.isCallStmt(target)) {
+      auto ChangedLock = lockIfConcurrent(ChangedCallJumpFnsMtx);
+      ChangedCallJumpFns.emplace_back(sourceVal, target, targetVal);
+    }
+    return fPrime;
+  }
+
   V joinValueAt(N unit, D fact, V curr, V newVal) {
     return ideTabulationProblem.join(curr, newVal);
   }
 
-  std::set<typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
+  std::vector<typename FlatTable<N, D, EdgeFunctionPtr<V>>::Cell>
   endSummary(N sP, D d3) {
     if (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
       auto key = std::make_pair(sP, d3);
@@ -1261,11 +2633,17 @@ protected:
         fSummaryReuse[key] += 1;
       }
     }
-    return endsummarytab.get(sP, d3).cellSet();
+    if (auto *Summaries = endsummarytab.find(sP, d3)) {
+      return Summaries->cellVec();
+    }
+    return {};
   }
 
   std::map<N, std::set<D>> incoming(D d1, N sP) {
-    return incomingtab.get(sP, d1);
+    if (auto *Incoming = incomingtab.find(sP, d1)) {
+      return *Incoming;
+    }
+    return {};
   }
 
   void addIncoming(N sP, D d3, N n, D d2) {
@@ -1273,9 +2651,13 @@ protected:
   }
 
   void printIncomingTab() {
+    // avoid copying the whole table if its contents are not logged anyway
+    if (!bl::core::get()->get_logging_enabled()) {
+      return;
+    }
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start of incomingtab entry");
-    for (auto cell : incomingtab.cellSet()) {
+    for (auto &cell : incomingtab) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "sP: " << ideTabulationProblem.NtoString(cell.r));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
@@ -1296,14 +2678,17 @@ protected:
   }
 
   void printEndSummaryTab() {
+    if (!bl::core::get()->get_logging_enabled()) {
+      return;
+    }
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start of endsummarytab entry");
-    for (auto cell : endsummarytab.cellVec()) {
+    for (auto &cell : endsummarytab) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "sP: " << ideTabulationProblem.NtoString(cell.r));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "d1: " << ideTabulationProblem.DtoString(cell.c));
-      for (auto inner_cell : cell.v.cellVec()) {
+      for (auto &inner_cell : cell.v) {
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "  eP: "
                       << ideTabulationProblem.NtoString(inner_cell.r));
@@ -1311,7 +2696,7 @@ protected:
                       << "  d2: "
                       << ideTabulationProblem.DtoString(inner_cell.c));
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "  EF: " << inner_cell.v->str());
+                      << "  EF: " << inner_cell.v.str());
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
       }
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "---------------");
@@ -1349,7 +2734,7 @@ protected:
      * Case 1: d1 in d2-Set
      * Case 2: d1 not in d2-Set, i.e. d1 was killed. d2-Set could be empty.
      */
-    for (auto cell : computedIntraPathEdges.cellSet()) {
+    for (auto &cell : computedIntraPathEdges) {
       auto Edge = std::make_pair(cell.r, cell.c);
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "N1: " << ideTabulationProblem.NtoString(Edge.first));
@@ -1391,7 +2776,21 @@ protected:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "==============================================");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "INTER PATH EDGES");
-    for (auto cell : computedInterPathEdges.cellSet()) {
+    // the summary handling below depends on the order in which the edges are
+    // visited, hence visit them in the order of their nodes
+    using PathEdgesCell =
+        typename FlatTable<N, N, std::map<D, std::set<D>>>::Cell;
+    std::vector<const PathEdgesCell *> InterCells;
+    InterCells.reserve(computedInterPathEdges.size());
+    for (auto &cell : computedInterPathEdges) {
+      InterCells.push_back(&cell);
+    }
+    std::sort(InterCells.begin(), InterCells.end(),
+              [](const PathEdgesCell *lhs, const PathEdgesCell *rhs) {
+                return std::tie(lhs->r, lhs->c) < std::tie(rhs->r, rhs->c);
+              });
+    for (auto *InterCell : InterCells) {
+      auto &cell = *InterCell;
       auto Edge = std::make_pair(cell.r, cell.c);
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "N1: " << ideTabulationProblem.NtoString(Edge.first));
@@ -1426,11 +2825,12 @@ protected:
             // Special case
             if (ProcessSummaryFacts.find(std::make_pair(Edge.second, D2)) !=
                 ProcessSummaryFacts.end()) {
-              std::multiset<D> SummaryDMultiSet =
-                  endsummarytab.get(Edge.second, D2).columnKeySet();
-              // remove duplicates from multiset
-              std::set<D> SummaryDSet(SummaryDMultiSet.begin(),
-                                      SummaryDMultiSet.end());
+              std::set<D> SummaryDSet;
+              if (auto *Summaries = endsummarytab.find(Edge.second, D2)) {
+                for (auto &Summary : *Summaries) {
+                  SummaryDSet.insert(Summary.c);
+                }
+              }
               // Process summary just as an intra-procedural edge
               if (SummaryDSet.find(D2) != SummaryDSet.end()) {
                 genFacts += SummaryDSet.size() - 1;
@@ -1532,6 +2932,18 @@ protected:
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                     << "Jump function construciton count: "
                     << GET_COUNTER("JumpFn Construction"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Path edge update count: "
+                    << GET_COUNTER("Path Edge Updates"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Coalesced path edge count: "
+                    << GET_COUNTER("Path Edges Coalesced"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Deferred path edge count: "
+                    << GET_COUNTER("Path Edges Deferred"));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Skipped path edge count: "
+                    << GET_COUNTER("Path Edges Skipped"));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                     << "Phase I duration: " << PRINT_TIMER("DFA Phase I"));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
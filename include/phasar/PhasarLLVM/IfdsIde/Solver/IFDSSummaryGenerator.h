@@ -17,14 +17,20 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IFDSSUMMARYGENERATOR_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IFDSSUMMARYGENERATOR_H_
 
+#include <algorithm>
+#include <atomic>
 #include <iostream> // std::cout
+#include <map>
+#include <memory>
 #include <set>
+#include <thread>
 #include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/GenAll.h>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
 #include <phasar/PhasarLLVM/Utils/SummaryStrategy.h>
+#include <phasar/Utils/Macros.h>
 
 namespace psr {
 
@@ -35,6 +41,7 @@ protected:
   const M toSummarize;
   const I icfg;
   const SummaryGenerationStrategy CTXStrategy;
+  const unsigned NumThreads;
 
   virtual std::vector<D> getInputs() = 0;
   virtual std::vector<bool> generateBitPattern(const std::vector<D> &inputs,
@@ -57,13 +64,80 @@ protected:
     virtual std::map<N, std::set<D>> initialSeeds() override {
       std::map<N, std::set<D>> seeds;
       seeds.insert(make_pair(start, facts));
+      // the values of all facts are derived from the zero value's
+      seeds[start].insert(this->zeroValue());
       return seeds;
     }
   };
 
+  /**
+   * Solves the function for the given context and returns the facts that
+   * hold at its exit.
+   */
+  std::set<D> solveContext(const std::set<D> &Context) {
+    CTXFunctionProblem functionProblem(
+        *icfg.getStartPointsOf(toSummarize).begin(), Context, icfg);
+    // concurrent solvers would interleave their output
+    ConcreteSolver solver(functionProblem, NumThreads <= 1);
+    solver.solve();
+    // get the result at the end of this function
+    std::set<N> LastInsts = icfg.getExitPointsOf(toSummarize);
+    std::set<D> results;
+    for (auto fact : solver.resultsAt(*LastInsts.begin())) {
+      results.insert(fact.first);
+    }
+    return results;
+  }
+
+  /**
+   * Solves the given contexts independently of each other using up to
+   * NumThreads threads and returns their results in the same order.
+   */
+  std::vector<std::set<D>>
+  solveContexts(const std::vector<std::set<D>> &Contexts) {
+    std::vector<std::set<D>> Results(Contexts.size());
+    size_t NumWorkers = std::min<size_t>(NumThreads, Contexts.size());
+    if (NumWorkers <= 1) {
+      for (size_t Idx = 0; Idx < Contexts.size(); ++Idx) {
+        Results[Idx] = solveContext(Contexts[Idx]);
+      }
+      return Results;
+    }
+    // the workers' solvers would otherwise register the counters while
+    // others already increment them
+    ConcreteSolver::registerCounters();
+    std::atomic<size_t> Next{0};
+    std::vector<std::thread> Workers;
+    for (size_t Worker = 0; Worker < NumWorkers; ++Worker) {
+      Workers.emplace_back([this, &Contexts, &Results, &Next]() {
+        for (size_t Idx = Next++; Idx < Contexts.size(); Idx = Next++) {
+          Results[Idx] = solveContext(Contexts[Idx]);
+        }
+      });
+    }
+    for (auto &Worker : Workers) {
+      Worker.join();
+    }
+    return Results;
+  }
+
 public:
-  IFDSSummaryGenerator(M Function, I icfg, SummaryGenerationStrategy Strategy)
-      : toSummarize(Function), icfg(icfg), CTXStrategy(Strategy) {}
+  /**
+   * NumThreads is the number of contexts that are solved concurrently.
+   * Values greater than one require the problem's flow functions and the
+   * ICFG to be thread-safe.
+   *
+   * If a strategy asks for more contexts than there are inputs plus one,
+   * e.g. the powerset strategy, only the empty and the singleton contexts
+   * are solved and the summaries for the others are assembled as unions of
+   * their results. This requires pure flow functions, i.e. functions whose
+   * targets for a fact do not depend on the other facts or on state that a
+   * previous query left behind.
+   */
+  IFDSSummaryGenerator(M Function, I icfg, SummaryGenerationStrategy Strategy,
+                       unsigned NumThreads = 1)
+      : toSummarize(Function), icfg(icfg), CTXStrategy(Strategy),
+        NumThreads(NumThreads) {}
   virtual ~IFDSSummaryGenerator() = default;
   virtual std::set<
       std::pair<std::vector<bool>, std::shared_ptr<FlowFunction<D>>>>
@@ -93,20 +167,42 @@ public:
       // TODO here we have to track what we have already observed first!
       break;
     }
-    for (auto subset : InputCombinations) {
+    // Since IFDS problems are distributive, the result for a context is the
+    // union of the results for the empty context and for each of its facts.
+    // Hence, if there are more contexts than inputs, e.g. for the powerset
+    // strategy, we only solve these contexts and assemble the others.
+    bool Assemble = InputCombinations.size() > inputset.size() + 1;
+    std::vector<std::set<D>> Contexts;
+    if (Assemble) {
+      Contexts.push_back(std::set<D>());
+      for (auto &input : inputset) {
+        Contexts.push_back({input});
+      }
+    } else {
+      Contexts.assign(InputCombinations.begin(), InputCombinations.end());
+    }
+    std::vector<std::set<D>> Results = solveContexts(Contexts);
+    std::map<D, const std::set<D> *> FactResults;
+    if (Assemble) {
+      size_t Idx = 1;
+      for (auto &input : inputset) {
+        FactResults[input] = &Results[Idx++];
+      }
+    }
+    size_t ContextIdx = 0;
+    for (auto &subset : InputCombinations) {
       std::cout << "Generate summary for specific context: "
                 << generateBitPattern(inputs, subset) << "\n";
-      CTXFunctionProblem functionProblem(
-          *icfg.getStartPointsOf(toSummarize).begin(), subset, icfg);
-      ConcreteSolver solver(functionProblem, true);
-      solver.solve();
-      // get the result at the end of this function and
-      // create a flow function from this set using the GenAll class
-      std::set<N> LastInsts = icfg.getExitPointsOf(toSummarize);
       std::set<D> results;
-      for (auto fact : solver.resultsAt(*LastInsts.begin())) {
-        results.insert(fact.first);
+      if (Assemble) {
+        results = Results.front();
+        for (auto &fact : subset) {
+          results.insert(FactResults[fact]->begin(), FactResults[fact]->end());
+        }
+      } else {
+        results = std::move(Results[ContextIdx++]);
       }
+      // create a flow function from this set using the GenAll class
       summary.insert(make_pair(
           generateBitPattern(inputs, subset),
           std::make_shared<GenAll<D>>(results, LLVMZeroValue::getInstance())));
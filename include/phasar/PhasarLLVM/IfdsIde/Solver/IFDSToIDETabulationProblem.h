@@ -13,6 +13,7 @@
 #include <memory>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
@@ -72,6 +73,72 @@ public:
 
   I interproceduralCFG() override { return problem.interproceduralCFG(); }
 
+  std::string getCacheKey() const override { return problem.getCacheKey(); }
+
+  void setMemoryResource(MonotonicArena *MR) override {
+    this->MemoryResource = MR;
+    problem.setMemoryResource(MR);
+  }
+
+  bool shouldTerminate(N n, D d) override {
+    return problem.shouldTerminate(n, d);
+  }
+
+  // the zero value's normal edge functions are all-bottom rather than the
+  // identity, which makes no difference since IFDS values are bottom
+  // wherever a fact holds
+  bool mayAffect(N n, D d) override { return problem.mayAffect(n, d); }
+
+  std::string NtoPersistedString(N n) override {
+    return problem.NtoPersistedString(n);
+  }
+
+  N persistedStringToN(const std::string &s) override {
+    return problem.persistedStringToN(s);
+  }
+
+  std::string DtoPersistedString(D d) override {
+    return problem.DtoPersistedString(d);
+  }
+
+  D persistedStringToD(const std::string &s) override {
+    return problem.persistedStringToD(s);
+  }
+
+  std::string VtoPersistedString(BinaryDomain v) override {
+    return BinaryDomainToString.at(v);
+  }
+
+  BinaryDomain persistedStringToV(const std::string &s) override {
+    return StringToBinaryDomain.at(s);
+  }
+
+  // the edge functions of IFDS problems, as well as their compositions and
+  // joins, are all-top, all-bottom or the identity
+  std::string edgeFunctionToPersistedString(
+      std::shared_ptr<EdgeFunction<BinaryDomain>> f) override {
+    if (dynamic_cast<AllTop<BinaryDomain> *>(f.get())) {
+      return "AllTop";
+    } else if (dynamic_cast<AllBottom<BinaryDomain> *>(f.get())) {
+      return "AllBottom";
+    } else if (dynamic_cast<EdgeIdentity<BinaryDomain> *>(f.get())) {
+      return "EdgeIdentity";
+    }
+    throw std::runtime_error("cannot persist edge function " + f->str());
+  }
+
+  std::shared_ptr<EdgeFunction<BinaryDomain>>
+  persistedStringToEdgeFunction(const std::string &s) override {
+    if (s == "AllTop") {
+      return allTopFunction();
+    } else if (s == "AllBottom") {
+      return ALL_BOTTOM;
+    } else if (s == "EdgeIdentity") {
+      return EdgeIdentity<BinaryDomain>::getInstance();
+    }
+    throw std::runtime_error("unknown edge function " + s);
+  }
+
   std::map<N, std::set<D>> initialSeeds() override {
     return problem.initialSeeds();
   }
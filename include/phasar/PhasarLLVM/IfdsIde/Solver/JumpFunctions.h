@@ -17,13 +17,24 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_JUMPFUNCTIONS_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_JUMPFUNCTIONS_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
-#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionPtr.h>
+#include <phasar/Utils/Concurrency.h>
+#include <phasar/Utils/FlatHashMap.h>
+#include <phasar/Utils/FlatTable.h>
+#include <phasar/Utils/Interner.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
-#include <phasar/Utils/Table.h>
 
 namespace psr {
 
@@ -35,43 +46,217 @@ class IDETabulationProblem;
 template <typename N, typename D, typename M, typename L, typename I>
 class JumpFunctions {
 private:
-  std::shared_ptr<EdgeFunction<L>> allTop;
+  EdgeFunctionPtr<L> allTop;
   const IDETabulationProblem<N, D, M, L, I> &problem;
 
 protected:
-  // mapping from target node and value to a list of all source values and
-  // associated functions where the list is implemented as a mapping from
-  // the source value to the function we exclude empty default functions
-  Table<N, D, std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyReverseLookup;
-  // mapping from source value and target node to a list of all target values
-  // and associated functions where the list is implemented as a mapping from
-  // the source value to the function we exclude empty default functions
-  Table<D, N, std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyForwardLookup;
-  // a mapping from target node to a list of triples consisting of source value,
-  // target value and associated function; the triple is implemented by a table
-  // we exclude empty default functions
-  std::unordered_map<N, Table<D, D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyLookupByTargetNode;
+  using Id = typename Interner<N>::Id;
+  // (target node, source value, target value)
+  using FunctionKey = std::tuple<Id, Id, Id>;
+  using IdIndex = FlatHashMap<Id, std::vector<Id>>;
+
+  // Nodes with at most this many jump functions answer lookups by source or
+  // target value by scanning their cells rather than using an index.
+  static constexpr size_t IndexThreshold = 8;
+
+  // The jump functions that end at one target node. Cells holds the ids of
+  // their source and target values. The indices from source to target values
+  // and vice versa are only built once a node with more than IndexThreshold
+  // jump functions is queried that way, which in practice are call sites.
+  struct TargetNode {
+    std::vector<std::pair<Id, Id>> Cells;
+    std::unique_ptr<IdIndex> Rows;
+    std::unique_ptr<IdIndex> Columns;
+  };
+
+  // The jump functions are partitioned into shards according to their target
+  // node, such that each lookup is answered by a single shard. Statements and
+  // data-flow facts are interned to dense ids per shard. Every access to a
+  // shard holds its mutex in concurrent solvers anyway, hence the interners
+  // need no synchronization of their own. Every jump function is stored once,
+  // in a flat map keyed by the ids of its target node and values; the
+  // target nodes are a flat array indexed by node id.
+  struct Shard {
+    std::mutex Mtx;
+    Interner<N> Nodes;
+    Interner<D> Facts;
+    FlatHashMap<FunctionKey, EdgeFunctionPtr<L>, TupleHash> Functions;
+    std::vector<TargetNode> Targets;
+  };
+  std::vector<std::unique_ptr<Shard>> Shards;
+  bool Concurrent;
+
+  Shard &getShard(N target) {
+    return *Shards[shardIndex(target, Shards.size())];
+  }
+
+  std::unique_lock<std::mutex> lockShard(Shard &S) {
+    return Concurrent ? std::unique_lock<std::mutex>(S.Mtx)
+                      : std::unique_lock<std::mutex>();
+  }
+
+  static void addToIndex(IdIndex *Index, Id Key, Id Value) {
+    if (Index) {
+      Index->insert(Key, {}).first->push_back(Value);
+    }
+  }
+
+  static void removeFromIndex(IdIndex *Index, Id Key, Id Value) {
+    if (!Index) {
+      return;
+    }
+    std::vector<Id> &Values = *Index->find(Key);
+    Values.erase(std::find(Values.begin(), Values.end(), Value));
+    if (Values.empty()) {
+      Index->erase(Key);
+    }
+  }
 
 public:
-  JumpFunctions(std::shared_ptr<EdgeFunction<L>> allTop,
-                const IDETabulationProblem<N, D, M, L, I> &p)
-      : allTop(allTop), problem(p) {}
+  /**
+   * A read-only view of the jump functions that end at one target node, see
+   * lookupByTargetView(). The forward and reverse lookups for the node are
+   * its rows and columns, respectively.
+   */
+  class TargetView {
+  private:
+    std::unique_lock<std::mutex> Lock;
+    Shard *S = nullptr;
+    TargetNode *T = nullptr;
+    Id Node = 0;
+
+    const EdgeFunctionPtr<L> &function(Id Source, Id Target) const {
+      return *S->Functions.find(std::make_tuple(Node, Source, Target));
+    }
+
+    // builds the index of Cells by their first (ByRow) or second id
+    void buildIndex(std::unique_ptr<IdIndex> &Index, bool ByRow) const {
+      Index = std::make_unique<IdIndex>();
+      for (const auto &Cell : T->Cells) {
+        addToIndex(Index.get(), ByRow ? Cell.first : Cell.second,
+                   ByRow ? Cell.second : Cell.first);
+      }
+    }
+
+    template <typename Fn>
+    void foreachInLine(D Val, bool ByRow, Fn F) const {
+      if (!T) {
+        return;
+      }
+      std::optional<Id> ValId = S->Facts.findId(Val);
+      if (!ValId) {
+        return;
+      }
+      auto visit = [&](Id Other) {
+        Id Source = ByRow ? *ValId : Other;
+        Id Target = ByRow ? Other : *ValId;
+        F(S->Facts.get(Other), function(Source, Target));
+      };
+      if (T->Cells.size() <= IndexThreshold) {
+        for (const auto &Cell : T->Cells) {
+          if ((ByRow ? Cell.first : Cell.second) == *ValId) {
+            visit(ByRow ? Cell.second : Cell.first);
+          }
+        }
+        return;
+      }
+      std::unique_ptr<IdIndex> &Index = ByRow ? T->Rows : T->Columns;
+      if (!Index) {
+        buildIndex(Index, ByRow);
+      }
+      if (const std::vector<Id> *Others = Index->find(*ValId)) {
+        for (Id Other : *Others) {
+          visit(Other);
+        }
+      }
+    }
+
+  public:
+    TargetView() = default;
+
+    TargetView(std::unique_lock<std::mutex> Lock, Shard &S, Id Node)
+        : Lock(std::move(Lock)), S(&S), T(&S.Targets[Node]), Node(Node) {}
+
+    ~TargetView() = default;
+
+    TargetView(TargetView &&) = default;
+
+    TargetView &operator=(TargetView &&) = default;
+
+    /**
+     * Calls F(sourceVal, targetVal, function) for every jump function.
+     */
+    template <typename Fn> void foreachCell(Fn F) const {
+      if (!T) {
+        return;
+      }
+      for (const auto &Cell : T->Cells) {
+        F(S->Facts.get(Cell.first), S->Facts.get(Cell.second),
+          function(Cell.first, Cell.second));
+      }
+    }
+
+    /**
+     * Calls F(targetVal, function) for every jump function from sourceVal.
+     */
+    template <typename Fn> void foreachInRow(D sourceVal, Fn F) const {
+      foreachInLine(sourceVal, true, F);
+    }
+
+    /**
+     * Calls F(sourceVal, function) for every jump function to targetVal.
+     */
+    template <typename Fn> void foreachInColumn(D targetVal, Fn F) const {
+      foreachInLine(targetVal, false, F);
+    }
+
+    std::unordered_map<D, EdgeFunctionPtr<L>> row(D sourceVal) const {
+      std::unordered_map<D, EdgeFunctionPtr<L>> Result;
+      foreachInRow(sourceVal, [&](D targetVal, const EdgeFunctionPtr<L> &f) {
+        Result.emplace(targetVal, f);
+      });
+      return Result;
+    }
+
+    std::unordered_map<D, EdgeFunctionPtr<L>> column(D targetVal) const {
+      std::unordered_map<D, EdgeFunctionPtr<L>> Result;
+      foreachInColumn(targetVal,
+                      [&](D sourceVal, const EdgeFunctionPtr<L> &f) {
+                        Result.emplace(sourceVal, f);
+                      });
+      return Result;
+    }
+
+    size_t size() const { return T ? T->Cells.size() : 0; }
+
+    bool empty() const { return size() == 0; }
+  };
+
+  /**
+   * Creates an empty set of jump functions. If NumShards is greater than one
+   * the jump functions may be accessed concurrently.
+   */
+  JumpFunctions(EdgeFunctionPtr<L> allTop,
+                const IDETabulationProblem<N, D, M, L, I> &p,
+                size_t NumShards = 1)
+      : allTop(allTop), problem(p), Concurrent(NumShards > 1) {
+    for (size_t Idx = 0; Idx < std::max<size_t>(NumShards, 1); ++Idx) {
+      Shards.push_back(std::make_unique<Shard>());
+    }
+  }
 
   ~JumpFunctions() = default;
 
-  JumpFunctions(const JumpFunctions &JFs) = default;
+  JumpFunctions(const JumpFunctions &JFs) = delete;
 
-  JumpFunctions(JumpFunctions &&JFs) = default;
+  JumpFunctions(JumpFunctions &&JFs) = delete;
 
   /**
    * Records a jump function. The source statement is implicit.
    * @see PathEdge
    */
   void addFunction(D sourceVal, N target, D targetVal,
-                   std::shared_ptr<EdgeFunction<L>> function) {
+                   EdgeFunctionPtr<L> function) {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start adding new jump function");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
@@ -81,35 +266,74 @@ public:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "Destination    : " << problem.NtoString(target));
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Edge Function  : " << function->str());
+                  << "Edge Function  : " << function.str());
     // we do not store the default function (all-top)
-    if (function->equal_to(allTop))
+    if (function.equal_to(allTop))
       return;
-    std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>> &sourceValToFunc =
-        nonEmptyReverseLookup.get(target, targetVal);
-    sourceValToFunc.insert({sourceVal, function});
-    //	printNonEmptyReverseLookup();
-    std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>> &targetValToFunc =
-        nonEmptyForwardLookup.get(sourceVal, target);
-    targetValToFunc.insert({targetVal, function});
-    //	printNonEmptyForwardLookup();
-    nonEmptyLookupByTargetNode[target].insert(sourceVal, targetVal, function);
-    //	printNonEmptyLookupByTargetNode();
+    Shard &S = getShard(target);
+    auto Lock = lockShard(S);
+    Id Node = S.Nodes.getId(target);
+    Id Source = S.Facts.getId(sourceVal);
+    Id Target = S.Facts.getId(targetVal);
+    if (Node == S.Targets.size()) {
+      S.Targets.emplace_back();
+    }
+    auto Inserted =
+        S.Functions.insert(std::make_tuple(Node, Source, Target), function);
+    if (!Inserted.second) {
+      *Inserted.first = std::move(function);
+    } else {
+      TargetNode &T = S.Targets[Node];
+      T.Cells.emplace_back(Source, Target);
+      addToIndex(T.Rows.get(), Source, Target);
+      addToIndex(T.Columns.get(), Target, Source);
+    }
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End adding new jump function");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
   }
 
+  /**
+   * Returns the jump function from sourceVal to targetVal at target, nullptr
+   * if there is none (i.e. it is all-top).
+   */
+  EdgeFunctionPtr<L> getFunction(D sourceVal, N target, D targetVal) {
+    Shard &S = getShard(target);
+    auto Lock = lockShard(S);
+    std::optional<Id> Node = S.Nodes.findId(target);
+    std::optional<Id> Source = S.Facts.findId(sourceVal);
+    std::optional<Id> Target = S.Facts.findId(targetVal);
+    if (!Node || !Source || !Target)
+      return nullptr;
+    const EdgeFunctionPtr<L> *Function =
+        S.Functions.find(std::make_tuple(*Node, *Source, *Target));
+    if (!Function)
+      return nullptr;
+    return *Function;
+  }
+
+  /**
+   * Returns a view on the jump functions that end at target rather than a
+   * copy, see lookupByTarget(). The view keeps the responsible shard locked
+   * as long as it is alive, so no jump functions must be added while holding
+   * it.
+   */
+  TargetView lookupByTargetView(N target) {
+    Shard &S = getShard(target);
+    auto Lock = lockShard(S);
+    std::optional<Id> Node = S.Nodes.findId(target);
+    if (!Node)
+      return TargetView();
+    return TargetView(std::move(Lock), S, *Node);
+  }
+
   /**
    * Returns, for a given target statement and value all associated
    * source values, and for each the associated edge function.
    * The return value is a mapping from source value to function.
    */
-  std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>
+  std::unordered_map<D, EdgeFunctionPtr<L>>
   reverseLookup(N target, D targetVal) {
-    if (!nonEmptyReverseLookup.contains(target, targetVal))
-      return std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>{};
-    else
-      return nonEmptyReverseLookup.get(target, targetVal);
+    return lookupByTargetView(target).column(targetVal);
   }
 
   /**
@@ -117,22 +341,24 @@ public:
    * associated target values, and for each the associated edge function.
    * The return value is a mapping from target value to function.
    */
-  std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>
+  std::unordered_map<D, EdgeFunctionPtr<L>>
   forwardLookup(D sourceVal, N target) {
-    if (!nonEmptyForwardLookup.contains(sourceVal, target))
-      return std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>{};
-    else
-      return nonEmptyForwardLookup.get(sourceVal, target);
+    return lookupByTargetView(target).row(sourceVal);
   }
 
   /**
    * Returns for a given target statement all jump function records with this
    * target.
-   * The return value is a set of records of the form
+   * The return value is a table of records of the form
    * (sourceVal,targetVal,edgeFunction).
    */
-  Table<D, D, std::shared_ptr<EdgeFunction<L>>> lookupByTarget(N target) {
-    return nonEmptyLookupByTargetNode[target];
+  FlatTable<D, D, EdgeFunctionPtr<L>> lookupByTarget(N target) {
+    FlatTable<D, D, EdgeFunctionPtr<L>> Result;
+    lookupByTargetView(target).foreachCell(
+        [&](D sourceVal, D targetVal, const EdgeFunctionPtr<L> &function) {
+          Result.insert(sourceVal, targetVal, function);
+        });
+    return Result;
   }
 
   /**
@@ -142,69 +368,65 @@ public:
    * there anyway.
    */
   bool removeFunction(D sourceVal, N target, D targetVal) {
-    nonEmptyReverseLookup.get(target, targetVal).erase(sourceVal);
-    nonEmptyForwardLookup.get(sourceVal, target).erase(targetVal);
-    return nonEmptyLookupByTargetNode.erase(target);
+    Shard &S = getShard(target);
+    auto Lock = lockShard(S);
+    std::optional<Id> Node = S.Nodes.findId(target);
+    std::optional<Id> Source = S.Facts.findId(sourceVal);
+    std::optional<Id> Target = S.Facts.findId(targetVal);
+    if (!Node || !Source || !Target ||
+        !S.Functions.erase(std::make_tuple(*Node, *Source, *Target)))
+      return false;
+    TargetNode &T = S.Targets[*Node];
+    auto Cell = std::find(T.Cells.begin(), T.Cells.end(),
+                          std::make_pair(*Source, *Target));
+    *Cell = T.Cells.back();
+    T.Cells.pop_back();
+    removeFromIndex(T.Rows.get(), *Source, *Target);
+    removeFromIndex(T.Columns.get(), *Target, *Source);
+    return true;
+  }
+
+  /**
+   * Calls F(sourceVal, target, targetVal, function) for every jump function.
+   * No jump functions must be added or removed meanwhile.
+   */
+  template <typename Fn> void foreachFunction(Fn F) const {
+    for (auto &S : Shards) {
+      S->Functions.forEach(
+          [&](const FunctionKey &Key, const EdgeFunctionPtr<L> &function) {
+            F(S->Facts.get(std::get<1>(Key)), S->Nodes.get(std::get<0>(Key)),
+              S->Facts.get(std::get<2>(Key)), function);
+          });
+    }
   }
 
   /**
    * Removes all jump functions
    */
   void clear() {
-    nonEmptyReverseLookup.clear();
-    nonEmptyForwardLookup.clear();
-    nonEmptyLookupByTargetNode.clear();
+    for (auto &S : Shards) {
+      auto Lock = lockShard(*S);
+      S->Nodes.clear();
+      S->Facts.clear();
+      S->Functions.clear();
+      S->Targets.clear();
+    }
   }
 
   void printJumpFunctions() {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Jump Functions:");
-    for (auto &entry : nonEmptyLookupByTargetNode) {
+    foreachFunction([&](D sourceVal, N target, D targetVal,
+                        const EdgeFunctionPtr<L> &function) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Node: " << problem.NtoString(entry.first));
-      for (auto cell : entry.second.cellSet()) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "fact at src: " << problem.DtoString(cell.r));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "fact at dst: " << problem.DtoString(cell.c));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "edge fnct: " << cell.v->str());
-      }
-    }
-  }
-
-  void printNonEmptyReverseLookup() {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "DUMP nonEmptyReverseLookup");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Table<N, D, std::unordered_map<D, "
-                     "std::shared_ptr<EdgeFunction<L>>>>");
-    auto cellset = nonEmptyReverseLookup.cellSet();
-    for (auto cell : cellset) {
-      cell.r->dump();
-      cell.c->dump();
-      for (auto edgefunction : cell.v) {
-        edgefunction.first->dump();
-        edgefunction.second->dump();
-      }
-    }
-  }
-
-  void printNonEmptyForwardLookup() {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "DUMP nonEmptyForwardLookup");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Table<D, N, std::unordered_map<D, "
-                     "std::shared_ptr<EdgeFunction<L>>>>");
-    auto cellset = nonEmptyForwardLookup.cellSet();
-    for (auto cell : cellset) {
-      cell.r->dump();
-      cell.c->dump();
-      for (auto edgefunction : cell.v) {
-        edgefunction.first->dump();
-        edgefunction.second->dump();
-      }
-    }
+                    << "Node: " << problem.NtoString(target));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "fact at src: " << problem.DtoString(sourceVal));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "fact at dst: " << problem.DtoString(targetVal));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "edge fnct: " << function.str());
+    });
   }
 
   void printNonEmptyLookupByTargetNode() {
@@ -212,18 +434,14 @@ public:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "DUMP nonEmptyLookupByTargetNode");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "std::unordered_map<N, Table<D, D, "
-                     "std::shared_ptr<EdgeFunction<L>>>>");
-    for (auto node : nonEmptyLookupByTargetNode) {
-      node.first->dump();
-      auto table = nonEmptyLookupByTargetNode[node.first];
-      auto cellset = table.cellSet();
-      for (auto cell : cellset) {
-        cell.r->dump();
-        cell.c->dump();
-        cell.v->dump();
-      }
-    }
+                  << "FlatHashMap<tuple<Id, Id, Id>, EdgeFunctionPtr<L>>");
+    foreachFunction([](D sourceVal, N target, D targetVal,
+                       const EdgeFunctionPtr<L> &function) {
+      target->dump();
+      sourceVal->dump();
+      targetVal->dump();
+      function->dump();
+    });
   }
 };
 
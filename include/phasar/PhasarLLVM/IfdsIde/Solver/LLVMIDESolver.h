@@ -61,7 +61,20 @@ public:
     }
   }
 
+  void resume(const std::string &path) override {
+    IDESolver<const llvm::Instruction *, D, const llvm::Function *, V,
+              I>::resume(path);
+    bl::core::get()->flush();
+    if (DUMP_RESULTS) {
+      dumpResults();
+    }
+    if (PRINT_REPORT) {
+      printReport();
+    }
+  }
+
   void printReport() {
+    this->computeRemainingValues();
     SolverResults<const llvm::Instruction *, D, V> SR(this->valtab,
                                                       Problem.zeroValue());
     Problem.printIDEReport(std::cout, SR);
@@ -70,39 +83,42 @@ public:
   void dumpResults() {
     PAMM_GET_INSTANCE;
     START_TIMER("DFA IDE Result Dumping", PAMM_SEVERITY_LEVEL::Full);
+    this->computeRemainingValues();
     std::cout << "### DUMP LLVMIDESolver results\n";
     // for the following line have a look at:
     // http://stackoverflow.com/questions/1120833/derived-template-class-access-to-base-class-member-data
     // https://isocpp.org/wiki/faq/templates#nondependent-name-lookup-members
-    auto results = this->valtab.cellSet();
-    if (results.empty()) {
+    if (this->valtab.empty()) {
       std::cout << "EMPTY" << std::endl;
     } else {
-      std::vector<typename Table<const llvm::Instruction *, D, V>::Cell> cells;
-      for (auto cell : results) {
-        cells.push_back(cell);
+      using ResultCell =
+          typename FlatTable<const llvm::Instruction *, D, V>::Cell;
+      // sort pointers to the cells rather than copies of them
+      std::vector<const ResultCell *> cells;
+      cells.reserve(this->valtab.size());
+      for (auto &cell : this->valtab) {
+        cells.push_back(&cell);
       }
       std::sort(cells.begin(), cells.end(),
-                [](typename Table<const llvm::Instruction *, D, V>::Cell a,
-                   typename Table<const llvm::Instruction *, D, V>::Cell b) {
-                  return a.r < b.r;
+                [](const ResultCell *a, const ResultCell *b) {
+                  return a->r < b->r;
                 });
       const llvm::Instruction *prev = nullptr;
       const llvm::Instruction *curr;
       for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
+        curr = cells[i]->r;
         if (prev != curr) {
           prev = curr;
           std::cout << "\n--- IDE START RESULT RECORD ---\n";
-          std::cout << "N: " << Problem.NtoString(cells[i].r)
+          std::cout << "N: " << Problem.NtoString(cells[i]->r)
                     << " in function: ";
           if (const llvm::Instruction *inst =
-                  llvm::dyn_cast<llvm::Instruction>(cells[i].r)) {
+                  llvm::dyn_cast<llvm::Instruction>(cells[i]->r)) {
             std::cout << inst->getFunction()->getName().str() << "\n";
           }
         }
-        std::cout << "D:\t" << Problem.DtoString(cells[i].c) << " "
-                  << "\tV:  " << Problem.VtoString(cells[i].v) << "\n";
+        std::cout << "D:\t" << Problem.DtoString(cells[i]->c) << " "
+                  << "\tV:  " << Problem.VtoString(cells[i]->v) << "\n";
       }
     }
     std::cout << '\n';
@@ -370,8 +386,7 @@ public:
 
   void dumpAllInterPathEdges() {
     std::cout << "COMPUTED INTER PATH EDGES" << std::endl;
-    auto interpe = this->computedInterPathEdges.cellSet();
-    for (auto &cell : interpe) {
+    for (auto &cell : this->computedInterPathEdges) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
       std::cout << "TO" << std::endl;
@@ -390,8 +405,7 @@ public:
 
   void dumpAllIntraPathEdges() {
     std::cout << "COMPUTED INTRA PATH EDGES" << std::endl;
-    auto intrape = this->computedIntraPathEdges.cellSet();
-    for (auto &cell : intrape) {
+    for (auto &cell : this->computedIntraPathEdges) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
       std::cout << "TO" << std::endl;
@@ -28,8 +28,8 @@
 #include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/SolverResults.h>
+#include <phasar/Utils/FlatTable.h>
 #include <phasar/Utils/PAMMMacros.h>
-#include <phasar/Utils/Table.h>
 
 using json = nlohmann::json;
 
@@ -68,7 +68,21 @@ public:
     }
   }
 
+  virtual void resume(const std::string &path) override {
+    // Continue the analysis from a checkpoint
+    IFDSSolver<const llvm::Instruction *, D, const llvm::Function *,
+               I>::resume(path);
+    bl::core::get()->flush();
+    if (DUMP_RESULTS) {
+      dumpResults();
+    }
+    if (PRINT_REPORT) {
+      printReport();
+    }
+  }
+
   void printReport() {
+    this->computeRemainingValues();
     SolverResults<const llvm::Instruction *, D, BinaryDomain> SR(
         this->valtab, Problem.zeroValue());
     Problem.printIFDSReport(std::cout, SR);
@@ -77,38 +91,39 @@ public:
   void dumpResults() {
     PAMM_GET_INSTANCE;
     START_TIMER("DFA IFDS Result Dumping", PAMM_SEVERITY_LEVEL::Full);
+    this->computeRemainingValues();
     std::cout << "### DUMP LLVMIFDSSolver results\n";
-    auto results = this->valtab.cellSet();
-    if (results.empty()) {
+    if (this->valtab.empty()) {
       std::cout << "EMPTY\n";
     } else {
-      std::vector<
-          typename Table<const llvm::Instruction *, D, BinaryDomain>::Cell>
-          cells;
-      for (auto cell : results) {
-        cells.push_back(cell);
+      using ResultCell =
+          typename FlatTable<const llvm::Instruction *, D, BinaryDomain>::Cell;
+      // sort pointers to the cells rather than copies of them
+      std::vector<const ResultCell *> cells;
+      cells.reserve(this->valtab.size());
+      for (auto &cell : this->valtab) {
+        cells.push_back(&cell);
       }
-      sort(
-          cells.begin(), cells.end(),
-          [](typename Table<const llvm::Instruction *, D, BinaryDomain>::Cell a,
-             typename Table<const llvm::Instruction *, D, BinaryDomain>::Cell
-                 b) { return a.r < b.r; });
+      sort(cells.begin(), cells.end(),
+           [](const ResultCell *a, const ResultCell *b) {
+             return a->r < b->r;
+           });
       const llvm::Instruction *prev = nullptr;
       const llvm::Instruction *curr;
       for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
+        curr = cells[i]->r;
         if (prev != curr) {
           prev = curr;
           std::cout << "--- IFDS START RESULT RECORD ---\n";
-          std::cout << "N: " << Problem.NtoString(cells[i].r)
+          std::cout << "N: " << Problem.NtoString(cells[i]->r)
                     << " in function: ";
           if (const llvm::Instruction *inst =
-                  llvm::dyn_cast<llvm::Instruction>(cells[i].r)) {
+                  llvm::dyn_cast<llvm::Instruction>(cells[i]->r)) {
             std::cout << inst->getFunction()->getName().str() << "\n";
           }
         }
-        std::cout << "D:\t" << Problem.DtoString(cells[i].c) << " "
-                  << "\tV:  " << cells[i].v << "\n";
+        std::cout << "D:\t" << Problem.DtoString(cells[i]->c) << " "
+                  << "\tV:  " << cells[i]->v << "\n";
       }
     }
     std::cout << '\n';
@@ -374,8 +389,7 @@ public:
 
   void dumpAllInterPathEdges() {
     std::cout << "COMPUTED INTER PATH EDGES" << std::endl;
-    auto interpe = this->computedInterPathEdges.cellSet();
-    for (auto &cell : interpe) {
+    for (auto &cell : this->computedInterPathEdges) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
       std::cout << "IN FUNCTION: " << cell.r->getFunction()->getName().str()
@@ -398,8 +412,7 @@ public:
 
   void dumpAllIntraPathEdges() {
     std::cout << "COMPUTED INTRA PATH EDGES" << std::endl;
-    auto intrape = this->computedIntraPathEdges.cellSet();
-    for (auto &cell : intrape) {
+    for (auto &cell : this->computedIntraPathEdges) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
       std::cout << "IN FUNCTION: " << cell.r->getFunction()->getName().str()
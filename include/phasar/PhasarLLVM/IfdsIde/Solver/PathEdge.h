@@ -41,11 +41,11 @@ public:
 
   PathEdge &operator=(PathEdge &&) = default;
 
-  N getTarget() { return target; }
+  N getTarget() const { return target; }
 
-  D factAtSource() { return dSource; }
+  D factAtSource() const { return dSource; }
 
-  D factAtTarget() { return dTarget; }
+  D factAtTarget() const { return dTarget; }
 
   friend std::ostream &operator<<(std::ostream &os, const PathEdge &pathEdge) {
     return os << "<" << pathEdge.dSource << "> -> <" << pathEdge.target << ","
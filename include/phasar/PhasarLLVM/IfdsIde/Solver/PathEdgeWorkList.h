@@ -0,0 +1,262 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_PATHEDGEWORKLIST_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_PATHEDGEWORKLIST_H_
+
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
+
+namespace psr {
+
+/**
+ * Holds the path edges that still have to be processed by the IDE/IFDS solver
+ * during Phase I. The order in which the edges are handed out is determined by
+ * the WorkListStrategy the work list has been constructed with.
+ *
+ * The ReversePostOrder and ExitFirst strategies order the edges of a method
+ * by a priority that the solver passes along with each edge; edges with
+ * smaller priorities are processed first. An edge that is pushed while an
+ * identical edge is still pending is dropped, since the solver always
+ * processes an edge with its current jump function.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts.
+ * @param <M> The type of objects used to represent methods.
+ */
+template <typename N, typename D, typename M> class PathEdgeWorkList {
+private:
+  WorkListStrategy Strategy;
+  // edges for the FIFO and LIFO strategies
+  std::deque<PathEdge<N, D>> Edges;
+  // edges for the method-batched strategy, grouped by the method that
+  // contains the edge's target node
+  std::unordered_map<M, std::deque<PathEdge<N, D>>> EdgesPerMethod;
+  // methods with pending edges in the order they have been discovered
+  std::deque<M> PendingMethods;
+  // edges for the ordered strategies, grouped by the method that contains
+  // the edge's target node and sorted by priority, target node and facts
+  std::unordered_map<M, std::set<std::tuple<size_t, N, D, D>>>
+      OrderedEdgesPerMethod;
+  // methods with pending edges, the most recently discovered method is on
+  // top, such that callees are processed before their callers
+  std::vector<M> MethodStack;
+  size_t NumEdges = 0;
+
+  bool isOrdered() const {
+    return Strategy == WorkListStrategy::ReversePostOrder ||
+           Strategy == WorkListStrategy::ExitFirst;
+  }
+
+public:
+  PathEdgeWorkList(WorkListStrategy Strategy = WorkListStrategy::LIFO)
+      : Strategy(Strategy) {}
+
+  ~PathEdgeWorkList() = default;
+
+  /**
+   * Schedules the given path edge whose target node lives in method Method.
+   * Priority is only used by the ordered strategies. Returns false if the
+   * edge has been coalesced with an identical pending edge.
+   */
+  bool push(PathEdge<N, D> Edge, M Method, size_t Priority = 0) {
+    if (isOrdered()) {
+      auto &MethodEdges = OrderedEdgesPerMethod[Method];
+      if (MethodEdges.empty()) {
+        MethodStack.push_back(Method);
+      }
+      if (!MethodEdges
+               .emplace(Priority, Edge.getTarget(), Edge.factAtSource(),
+                        Edge.factAtTarget())
+               .second) {
+        return false;
+      }
+      ++NumEdges;
+      return true;
+    }
+    ++NumEdges;
+    if (Strategy == WorkListStrategy::MethodBatched) {
+      auto &MethodEdges = EdgesPerMethod[Method];
+      if (MethodEdges.empty()) {
+        PendingMethods.push_back(Method);
+      }
+      MethodEdges.push_back(Edge);
+    } else {
+      Edges.push_back(Edge);
+    }
+    return true;
+  }
+
+  /**
+   * Removes and returns the next path edge to be processed. The work list
+   * must not be empty.
+   */
+  PathEdge<N, D> pop() {
+    assert(!empty() && "pop() called on an empty work list");
+    --NumEdges;
+    switch (Strategy) {
+    case WorkListStrategy::FIFO: {
+      PathEdge<N, D> Edge = Edges.front();
+      Edges.pop_front();
+      return Edge;
+    }
+    case WorkListStrategy::LIFO: {
+      PathEdge<N, D> Edge = Edges.back();
+      Edges.pop_back();
+      return Edge;
+    }
+    case WorkListStrategy::ReversePostOrder:
+    case WorkListStrategy::ExitFirst: {
+      // stay within the top-most method until all of its edges are processed
+      auto Search = OrderedEdgesPerMethod.find(MethodStack.back());
+      auto First = Search->second.begin();
+      PathEdge<N, D> Edge(std::get<2>(*First), std::get<1>(*First),
+                          std::get<3>(*First));
+      Search->second.erase(First);
+      if (Search->second.empty()) {
+        OrderedEdgesPerMethod.erase(Search);
+        MethodStack.pop_back();
+      }
+      return Edge;
+    }
+    case WorkListStrategy::MethodBatched:
+    default: {
+      // stay within the current method until all of its edges are processed
+      auto Search = EdgesPerMethod.find(PendingMethods.front());
+      PathEdge<N, D> Edge = Search->second.front();
+      Search->second.pop_front();
+      if (Search->second.empty()) {
+        EdgesPerMethod.erase(Search);
+        PendingMethods.pop_front();
+      }
+      return Edge;
+    }
+    }
+  }
+
+  /**
+   * Removes the next path edge to be processed together with the edges that
+   * would be handed out right after it and end at the same target node, and
+   * appends them to Batch. The work list must not be empty.
+   */
+  void popBatch(std::vector<PathEdge<N, D>> &Batch) {
+    Batch.push_back(pop());
+    N Target = Batch.front().getTarget();
+    switch (Strategy) {
+    case WorkListStrategy::FIFO:
+      while (!Edges.empty() && Edges.front().getTarget() == Target) {
+        Batch.push_back(pop());
+      }
+      break;
+    case WorkListStrategy::LIFO:
+      while (!Edges.empty() && Edges.back().getTarget() == Target) {
+        Batch.push_back(pop());
+      }
+      break;
+    case WorkListStrategy::ReversePostOrder:
+    case WorkListStrategy::ExitFirst: {
+      // the edges of a node share its priority and are adjacent
+      M Method = MethodStack.empty() ? M() : MethodStack.back();
+      auto Search = OrderedEdgesPerMethod.find(Method);
+      while (Search != OrderedEdgesPerMethod.end() &&
+             std::get<1>(*Search->second.begin()) == Target) {
+        Batch.push_back(pop());
+        Search = OrderedEdgesPerMethod.find(Method);
+      }
+      break;
+    }
+    case WorkListStrategy::MethodBatched:
+    default: {
+      M Method = PendingMethods.empty() ? M() : PendingMethods.front();
+      auto Search = EdgesPerMethod.find(Method);
+      while (Search != EdgesPerMethod.end() &&
+             Search->second.front().getTarget() == Target) {
+        Batch.push_back(pop());
+        Search = EdgesPerMethod.find(Method);
+      }
+      break;
+    }
+    }
+  }
+
+  /**
+   * Returns whether edges of the given method are pending. Only supported by
+   * the strategies that group the edges per method, the other strategies
+   * report pending edges as long as the work list is not empty.
+   */
+  bool hasPendingEdges(M Method) const {
+    if (Strategy == WorkListStrategy::MethodBatched) {
+      return EdgesPerMethod.count(Method);
+    }
+    if (isOrdered()) {
+      return OrderedEdgesPerMethod.count(Method);
+    }
+    return !empty();
+  }
+
+  /**
+   * Returns whether the edges are grouped per method, i.e. whether all
+   * pending edges of a method are processed before the next method.
+   */
+  bool isGroupedByMethod() const {
+    return Strategy == WorkListStrategy::MethodBatched || isOrdered();
+  }
+
+  /**
+   * Calls F for every pending edge, in an order in which pushing the edges
+   * into an empty work list with the same strategy restores this work list.
+   */
+  template <typename Fn> void foreachEdge(Fn F) const {
+    if (isOrdered()) {
+      for (M Method : MethodStack) {
+        for (const auto &Entry : OrderedEdgesPerMethod.at(Method)) {
+          F(PathEdge<N, D>(std::get<2>(Entry), std::get<1>(Entry),
+                           std::get<3>(Entry)));
+        }
+      }
+    } else if (Strategy == WorkListStrategy::MethodBatched) {
+      for (M Method : PendingMethods) {
+        for (const auto &Edge : EdgesPerMethod.at(Method)) {
+          F(Edge);
+        }
+      }
+    } else {
+      for (const auto &Edge : Edges) {
+        F(Edge);
+      }
+    }
+  }
+
+  bool empty() const { return NumEdges == 0; }
+
+  size_t size() const { return NumEdges; }
+
+  WorkListStrategy getStrategy() const { return Strategy; }
+
+  void clear() {
+    Edges.clear();
+    EdgesPerMethod.clear();
+    PendingMethods.clear();
+    OrderedEdgesPerMethod.clear();
+    MethodStack.clear();
+    NumEdges = 0;
+  }
+};
+
+} // namespace psr
+
+#endif
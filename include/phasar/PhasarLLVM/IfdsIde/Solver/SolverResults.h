@@ -22,20 +22,23 @@
 #include <unordered_map>
 
 #include <phasar/PhasarLLVM/Utils/BinaryDomain.h>
-#include <phasar/Utils/Table.h>
+#include <phasar/Utils/FlatTable.h>
 
 namespace psr {
 
 template <typename N, typename D, typename V> class SolverResults {
 private:
-  Table<N, D, V> &results;
+  const FlatTable<N, D, V> &results;
   D zeroValue;
 
 public:
-  SolverResults(Table<N, D, V> &res_tab, D zv)
+  SolverResults(const FlatTable<N, D, V> &res_tab, D zv)
       : results(res_tab), zeroValue(zv) {}
 
-  V valueAt(N stmt, D node) { return results.get(stmt, node); }
+  V valueAt(N stmt, D node) {
+    const V *Value = results.find(stmt, node);
+    return Value ? *Value : V();
+  }
 
   std::unordered_map<D, V> resultsAt(N stmt, bool stripZero = false) {
     std::unordered_map<D, V> result = results.row(stmt);
@@ -17,10 +17,40 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVERCONFIGURATION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVERCONFIGURATION_H_
 
+#include <cstddef>
 #include <iosfwd>
+#include <string>
 
 namespace psr {
 
+/**
+ * Determines the order in which the IDE/IFDS solver processes the path edges
+ * that are pending in its worklist during Phase I.
+ *
+ *  - FIFO             : breadth-first, edges are processed in insertion order
+ *  - LIFO             : depth-first, mimics the former recursive propagation
+ *  - MethodBatched    : all pending edges of a method are processed before
+ *                       the solver moves on to the next method
+ *  - ReversePostOrder : like MethodBatched, but the edges of a method are
+ *                       processed in reverse post-order of their target
+ *                       nodes, identical pending edges are coalesced and the
+ *                       most recently reached method is processed first
+ *  - ExitFirst        : like ReversePostOrder, but edges at exit nodes are
+ *                       processed first, such that end summaries become
+ *                       available before the callers query them
+ *
+ * The strategies only apply to single-threaded solving.
+ */
+enum class WorkListStrategy {
+  FIFO,
+  LIFO,
+  MethodBatched,
+  ReversePostOrder,
+  ExitFirst
+};
+
+std::ostream &operator<<(std::ostream &os, const WorkListStrategy &S);
+
 struct SolverConfiguration {
   SolverConfiguration() = default;
   SolverConfiguration(bool followReturnsPastSeeds, bool autoAddZero,
@@ -40,6 +70,43 @@ struct SolverConfiguration {
   bool computeValues = false;
   bool recordEdges = false;
   bool computePersistedSummaries = false;
+  WorkListStrategy workListStrategy = WorkListStrategy::LIFO;
+  // Number of worker threads used for Phase I. Values greater than one
+  // require the problem's flow and edge functions to be thread-safe.
+  unsigned numThreads = 1;
+  // Maximal number of memoized compositions and joins of edge functions, zero
+  // disables memoization. Requires composeWith() and joinWith() to only
+  // depend on their operands.
+  size_t edgeFunctionMemoSize = 0;
+  // Maximal number of entries of each of the flow and edge function caches,
+  // zero if the caches are unbounded. Full caches evict their least recently
+  // hit entries.
+  size_t flowEdgeFunctionCacheSize = 0;
+  // Releases the cached flow and edge functions of a method once all pending
+  // path edges of the method have been processed. Requires a work list
+  // strategy that groups the edges per method and a single thread.
+  bool releaseFinishedMethods = false;
+  // Allocates the cached flow and edge functions, as well as the functions
+  // that the problem creates using IFDSTabulationProblem::makeFunction(),
+  // from an arena that is freed as a whole along with the caches. Has no
+  // effect if the caches are bounded or release finished methods.
+  bool allocateFromArena = false;
+  // Propagates facts past the nodes that do not affect them, see
+  // IFDSTabulationProblem::mayAffect(), instead of processing every node.
+  bool sparsePropagation = false;
+  // Computes the values at the nodes that are neither call sites nor start
+  // points only once they are queried using resultAt() or resultsAt(), rather
+  // than for all nodes after Phase I. Printing reports or dumping all results
+  // computes the remaining values.
+  bool lazyValueComputation = false;
+  // Writes the state of the solver to this file every checkpointInterval
+  // seconds, or only when the process receives SIGTERM if the interval is
+  // zero, such that an interrupted run can be continued using
+  // IDESolver::resume(). Requires the problem to support checkpoints, see
+  // IDETabulationProblem::edgeFunctionToPersistedString(). An empty file name
+  // disables checkpoints.
+  std::string checkpointFile;
+  unsigned checkpointInterval = 0;
   friend std::ostream &operator<<(std::ostream &os,
                                   const SolverConfiguration &sc);
 };
@@ -17,9 +17,11 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_ZEROEDFLOWFUNCTIONS_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_ZEROEDFLOWFUNCTIONS_H_
 
+#include <algorithm>
 #include <memory>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <set>
+#include <vector>
 
 namespace psr {
 
@@ -31,15 +33,30 @@ private:
 public:
   ZeroedFlowFunction(std::shared_ptr<FlowFunction<D>> ff, D zv)
       : delegate(ff), zerovalue(zv) {}
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargets(D source) override {
     if (source == zerovalue) {
-      std::set<D> result = delegate->computeTargets(source);
-      result.insert(zerovalue);
+      FFSet<D> result = delegate->computeTargets(source);
+      if (std::find(result.begin(), result.end(), zerovalue) == result.end()) {
+        result.push_back(zerovalue);
+      }
       return result;
     } else {
       return delegate->computeTargets(source);
     }
   }
+  void computeTargetsBatch(const std::vector<D> &Sources,
+                           TargetBuffer<D> &Targets) override {
+    TargetBuffer<D> Result;
+    delegate->computeTargetsBatch(Sources, Result);
+    Targets.reserve(Sources.size(), Result.targets().size() + 1);
+    for (size_t Idx = 0; Idx < Sources.size(); ++Idx) {
+      Targets.add(Result.begin(Idx), Result.end(Idx));
+      if (Sources[Idx] == zerovalue) {
+        Targets.add(zerovalue);
+      }
+      Targets.endSource();
+    }
+  }
 };
 } // namespace psr
 
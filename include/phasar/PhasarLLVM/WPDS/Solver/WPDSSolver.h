@@ -32,7 +32,7 @@
 #include <wali/wpds/fwpds/FWPDS.hpp>
 #include <wali/wpds/fwpds/SWPDS.hpp>
 
-#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionPtr.h>
 #include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
@@ -185,21 +185,20 @@ public:
     D d1 = edge.factAtSource();
     N n = edge.getTarget();
     D d2 = edge.factAtTarget();
-    std::shared_ptr<EdgeFunction<V>> f =
-        IDESolver<N, D, M, V, I>::jumpFunction(edge);
+    EdgeFunctionPtr<V> f = IDESolver<N, D, M, V, I>::jumpFunction(edge);
     auto successorInst = IDESolver<N, D, M, V, I>::icfg.getSuccsOf(n);
     for (auto m : successorInst) {
       std::shared_ptr<FlowFunction<D>> flowFunction =
           IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
               .getNormalFlowFunction(n, m);
       INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-      std::set<D> res = IDESolver<N, D, M, V, I>::computeNormalFlowFunction(
+      FFSet<D> res = IDESolver<N, D, M, V, I>::computeNormalFlowFunction(
           flowFunction, d1, d2);
       ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                        PAMM_SEVERITY_LEVEL::Full);
       IDESolver<N, D, M, V, I>::saveEdges(n, m, d2, res, false);
       for (D d3 : res) {
-        std::shared_ptr<EdgeFunction<V>> g =
+        EdgeFunctionPtr<V> g =
             IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                 .getNormalEdgeFunction(n, d2, m, d3);
         // add normal PDS rule
@@ -211,7 +210,7 @@ public:
         auto m_k = wali::getKey(m);
         wali::ref_ptr<JoinLatticeToSemiRingElem<V>> wptr;
         wptr = new JoinLatticeToSemiRingElem<V>(
-            g, static_cast<JoinLattice<V> &>(P));
+            g.get(), static_cast<JoinLattice<V> &>(P));
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "ADD NORMAL RULE: " << P.DtoString(d2) << " | "
                       << P.NtoString(n) << " --> " << P.DtoString(d3) << " | "
@@ -220,9 +219,9 @@ public:
         if (!SRElem.is_valid()) {
           SRElem = wptr;
         }
-        std::shared_ptr<EdgeFunction<V>> fprime = f->composeWith(g);
+        EdgeFunctionPtr<V> fprime = f.composeWith(g);
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Compose: " << g->str() << " * " << f->str());
+                      << "Compose: " << g.str() << " * " << f.str());
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
         INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         IDESolver<N, D, M, V, I>::propagate(d1, m, d3, fprime, nullptr, false);
@@ -241,8 +240,7 @@ public:
     D d1 = edge.factAtSource();
     N n = edge.getTarget(); // a call node; line 14...
     D d2 = edge.factAtTarget();
-    std::shared_ptr<EdgeFunction<V>> f =
-        IDESolver<N, D, M, V, I>::jumpFunction(edge);
+    EdgeFunctionPtr<V> f = IDESolver<N, D, M, V, I>::jumpFunction(edge);
     std::set<N> returnSiteNs =
         IDESolver<N, D, M, V, I>::icfg.getReturnSitesOfCallAt(n);
     std::set<M> callees = IDESolver<N, D, M, V, I>::icfg.getCalleesOfCallAt(n);
@@ -268,7 +266,7 @@ public:
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Found and process special summary");
         for (N returnSiteN : returnSiteNs) {
-          std::set<D> res =
+          FFSet<D> res =
               IDESolver<N, D, M, V, I>::computeSummaryFlowFunction(specialSum,
                                                                    d1, d2);
           INC_COUNTER("SpecialSummary-FF Application", 1,
@@ -277,17 +275,17 @@ public:
                            PAMM_SEVERITY_LEVEL::Full);
           IDESolver<N, D, M, V, I>::saveEdges(n, returnSiteN, d2, res, false);
           for (D d3 : res) {
-            std::shared_ptr<EdgeFunction<V>> sumEdgFnE =
+            EdgeFunctionPtr<V> sumEdgFnE =
                 IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                     .getSummaryEdgeFunction(n, d2, returnSiteN, d3);
             INC_COUNTER("SpecialSummary-EF Queries", 1,
                         PAMM_SEVERITY_LEVEL::Full);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << sumEdgFnE->str() << " * "
-                          << f->str());
+                          << "Compose: " << sumEdgFnE.str() << " * "
+                          << f.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
             IDESolver<N, D, M, V, I>::propagate(
-                d1, returnSiteN, d3, f->composeWith(sumEdgFnE), n, false);
+                d1, returnSiteN, d3, f.composeWith(sumEdgFnE), n, false);
           }
         }
       } else {
@@ -296,7 +294,7 @@ public:
             IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                 .getCallFlowFunction(n, sCalledProcN);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> res =
+        FFSet<D> res =
             IDESolver<N, D, M, V, I>::computeCallFlowFunction(function, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                          PAMM_SEVERITY_LEVEL::Full);
@@ -316,18 +314,14 @@ public:
           for (D d3 : res) {
             // create initial self-loop
             IDESolver<N, D, M, V, I>::propagate(
-                d3, sP, d3, EdgeIdentity<V>::getInstance(), n,
+                d3, sP, d3, EdgeFunctionPtr<V>::identity(), n,
                 false); // line 15
             // register the fact that <sp,d3> has an incoming edge from <n,d2>
             // line 15.1 of Naeem/Lhotak/Rodriguez
             IDESolver<N, D, M, V, I>::addIncoming(sP, d3, n, d2);
             // line 15.2, copy to avoid concurrent modification exceptions by
             // other threads
-            std::set<
-                typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
-                endSumm = std::set<typename Table<
-                    N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>(
-                    IDESolver<N, D, M, V, I>::endSummary(sP, d3));
+            auto endSumm = IDESolver<N, D, M, V, I>::endSummary(sP, d3);
             // std::cout << "ENDSUMM" << std::endl;
             // std::cout << "Size: " << endSumm.size() << std::endl;
             // std::cout << "sP: " << ideTabulationProblem.NtoString(sP)
@@ -339,12 +333,10 @@ public:
             // <sP,d3>, create new caller-side jump functions to the return
             // sites because we have observed a potentially new incoming
             // edge into <sP,d3>
-            for (typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell
-                     entry : endSumm) {
+            for (auto &entry : endSumm) {
               N eP = entry.getRowKey();
               D d4 = entry.getColumnKey();
-              std::shared_ptr<EdgeFunction<V>> fCalleeSummary =
-                  entry.getValue();
+              EdgeFunctionPtr<V> fCalleeSummary = entry.getValue();
               // for each return site
               for (N retSiteN : returnSiteNs) {
                 // compute return-flow function
@@ -352,7 +344,7 @@ public:
                     IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                         .getRetFlowFunction(n, sCalledProcN, eP, retSiteN);
                 INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-                std::set<D> returnedFacts =
+                FFSet<D> returnedFacts =
                     IDESolver<N, D, M, V, I>::computeReturnFlowFunction(
                         retFunction, d3, d4, n, std::set<D>{d2});
                 ADD_TO_HISTOGRAM("Data-flow facts", returnedFacts.size(), 1,
@@ -363,7 +355,7 @@ public:
                 for (D d5 : returnedFacts) {
                   // update the caller-side summary function
                   // get call edge function
-                  std::shared_ptr<EdgeFunction<V>> f4 =
+                  EdgeFunctionPtr<V> f4 =
                       IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                           .getCallEdgeFunction(n, d2, sCalledProcN, d3);
                   // add call PDS rule
@@ -375,7 +367,7 @@ public:
                   auto sP_k = wali::getKey(sP);
                   wali::ref_ptr<JoinLatticeToSemiRingElem<V>> wptrCall(
                       new JoinLatticeToSemiRingElem<V>(
-                          f4, static_cast<JoinLattice<V> &>(P)));
+                          f4.get(), static_cast<JoinLattice<V> &>(P)));
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                                 << "ADD CALL RULE: " << P.DtoString(d2) << ", "
                                 << P.NtoString(n) << ", " << P.DtoString(d3)
@@ -387,7 +379,7 @@ public:
                     SRElem = wptrCall;
                   }
                   // get return edge function
-                  std::shared_ptr<EdgeFunction<V>> f5 =
+                  EdgeFunctionPtr<V> f5 =
                       IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                           .getReturnEdgeFunction(n, sCalledProcN, eP, d4,
                                                  retSiteN, d5);
@@ -398,7 +390,7 @@ public:
                   DKey[d5] = d5_k;
                   wali::ref_ptr<JoinLatticeToSemiRingElem<V>> wptrRet(
                       new JoinLatticeToSemiRingElem<V>(
-                          f5, static_cast<JoinLattice<V> &>(P)));
+                          f5.get(), static_cast<JoinLattice<V> &>(P)));
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                                 << "ADD RET RULE (CALL): " << P.DtoString(d4)
                                 << ", " << P.NtoString(retSiteN) << ", "
@@ -416,25 +408,25 @@ public:
                   INC_COUNTER("EF Queries", 2, PAMM_SEVERITY_LEVEL::Full);
                   // compose call * calleeSummary * return edge functions
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Compose: " << f5->str() << " * "
-                                << fCalleeSummary->str() << " * " << f4->str());
+                                << "Compose: " << f5.str() << " * "
+                                << fCalleeSummary.str() << " * " << f4.str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                                 << "         (return * calleeSummary * call)");
-                  std::shared_ptr<EdgeFunction<V>> fPrime =
-                      f4->composeWith(fCalleeSummary)->composeWith(f5);
+                  EdgeFunctionPtr<V> fPrime =
+                      f4.composeWith(fCalleeSummary).composeWith(f5);
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "       = " << fPrime->str());
+                                << "       = " << fPrime.str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
                   D d5_restoredCtx =
                       IDESolver<N, D, M, V, I>::restoreContextOnReturnedFact(
                           n, d2, d5);
                   // propagte the effects of the entire call
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Compose: " << fPrime->str() << " * "
-                                << f->str());
+                                << "Compose: " << fPrime.str() << " * "
+                                << f.str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
                   IDESolver<N, D, M, V, I>::propagate(
-                      d1, retSiteN, d5_restoredCtx, f->composeWith(fPrime), n,
+                      d1, retSiteN, d5_restoredCtx, f.composeWith(fPrime), n,
                       false);
                 }
               }
@@ -449,7 +441,7 @@ public:
             IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                 .getCallToRetFlowFunction(n, returnSiteN, callees);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> returnFacts =
+        FFSet<D> returnFacts =
             IDESolver<N, D, M, V, I>::computeCallToReturnFlowFunction(
                 callToReturnFlowFunction, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", returnFacts.size(), 1,
@@ -457,7 +449,7 @@ public:
         IDESolver<N, D, M, V, I>::saveEdges(n, returnSiteN, d2, returnFacts,
                                             false);
         for (D d3 : returnFacts) {
-          std::shared_ptr<EdgeFunction<V>> edgeFnE =
+          EdgeFunctionPtr<V> edgeFnE =
               IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                   .getCallToRetEdgeFunction(n, d2, returnSiteN, d3, callees);
           // add calltoret PDS rule
@@ -469,7 +461,7 @@ public:
           auto returnSiteN_k = wali::getKey(returnSiteN);
           wali::ref_ptr<JoinLatticeToSemiRingElem<V>> wptr(
               new JoinLatticeToSemiRingElem<V>(
-                  edgeFnE, static_cast<JoinLattice<V> &>(P)));
+                  edgeFnE.get(), static_cast<JoinLattice<V> &>(P)));
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                         << "ADD CALLTORET RULE: " << P.DtoString(d2) << " | "
                         << P.NtoString(n) << " --> " << P.DtoString(d3) << ", "
@@ -480,10 +472,10 @@ public:
           }
           INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Compose: " << edgeFnE->str() << " * " << f->str());
+                        << "Compose: " << edgeFnE.str() << " * " << f.str());
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
           IDESolver<N, D, M, V, I>::propagate(
-              d1, returnSiteN, d3, f->composeWith(edgeFnE), n, false);
+              d1, returnSiteN, d3, f.composeWith(edgeFnE), n, false);
         }
       }
     }
@@ -498,8 +490,7 @@ public:
                   << "Process exit at target: "
                   << this->ideTabulationProblem.NtoString(edge.getTarget()));
     N n = edge.getTarget(); // an exit node; line 21...
-    std::shared_ptr<EdgeFunction<V>> f =
-        IDESolver<N, D, M, V, I>::jumpFunction(edge);
+    EdgeFunctionPtr<V> f = IDESolver<N, D, M, V, I>::jumpFunction(edge);
     M methodThatNeedsSummary = IDESolver<N, D, M, V, I>::icfg.getMethodOf(n);
     D d1 = edge.factAtSource();
     D d2 = edge.factAtTarget();
@@ -532,7 +523,7 @@ public:
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         // for each incoming-call value
         for (D d4 : entry.second) {
-          std::set<D> targets =
+          FFSet<D> targets =
               IDESolver<N, D, M, V, I>::computeReturnFlowFunction(
                   retFunction, d1, d2, c, entry.second);
           ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
@@ -544,13 +535,13 @@ public:
           for (D d5 : targets) {
             // compute composed function
             // get call edge function
-            std::shared_ptr<EdgeFunction<V>> f4 =
+            EdgeFunctionPtr<V> f4 =
                 IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                     .getCallEdgeFunction(
                         c, d4, IDESolver<N, D, M, V, I>::icfg.getMethodOf(n),
                         d1);
             // get return edge function
-            std::shared_ptr<EdgeFunction<V>> f5 =
+            EdgeFunctionPtr<V> f5 =
                 IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                     .getReturnEdgeFunction(
                         c, IDESolver<N, D, M, V, I>::icfg.getMethodOf(n), n, d2,
@@ -565,7 +556,7 @@ public:
             auto n_k = wali::getKey(n);
             wali::ref_ptr<JoinLatticeToSemiRingElem<V>> wptr(
                 new JoinLatticeToSemiRingElem<V>(
-                    f5, static_cast<JoinLattice<V> &>(P)));
+                    f5.get(), static_cast<JoinLattice<V> &>(P)));
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                           << "ADD RET RULE: " << P.DtoString(d2) << ", "
                           << P.NtoString(n) << ", " << P.DtoString(d5) << ", "
@@ -577,31 +568,30 @@ public:
             INC_COUNTER("EF Queries", 2, PAMM_SEVERITY_LEVEL::Full);
             // compose call function * function * return function
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << f5->str() << " * " << f->str()
-                          << " * " << f4->str());
+                          << "Compose: " << f5.str() << " * " << f.str()
+                          << " * " << f4.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                           << "         (return * function * call)");
-            std::shared_ptr<EdgeFunction<V>> fPrime =
-                f4->composeWith(f)->composeWith(f5);
+            EdgeFunctionPtr<V> fPrime = f4.composeWith(f).composeWith(f5);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "       = " << fPrime->str());
+                          << "       = " << fPrime.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
             // for each jump function coming into the call, propagate to return
             // site using the composed function
             for (auto valAndFunc :
                  IDESolver<N, D, M, V, I>::jumpFn->reverseLookup(c, d4)) {
-              std::shared_ptr<EdgeFunction<V>> f3 = valAndFunc.second;
-              if (!f3->equal_to(IDESolver<N, D, M, V, I>::allTop)) {
+              EdgeFunctionPtr<V> f3 = valAndFunc.second;
+              if (!f3.equal_to(IDESolver<N, D, M, V, I>::allTop)) {
                 D d3 = valAndFunc.first;
                 D d5_restoredCtx =
                     IDESolver<N, D, M, V, I>::restoreContextOnReturnedFact(
                         c, d4, d5);
                 LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                              << "Compose: " << fPrime->str() << " * "
-                              << f3->str());
+                              << "Compose: " << fPrime.str() << " * "
+                              << f3.str());
                 LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
                 IDESolver<N, D, M, V, I>::propagate(
-                    d3, retSiteC, d5_restoredCtx, f3->composeWith(fPrime), c,
+                    d3, retSiteC, d5_restoredCtx, f3.composeWith(fPrime), c,
                     false);
               }
             }
@@ -625,7 +615,7 @@ public:
               IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                   .getRetFlowFunction(c, methodThatNeedsSummary, n, retSiteC);
           INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-          std::set<D> targets =
+          FFSet<D> targets =
               IDESolver<N, D, M, V, I>::computeReturnFlowFunction(
                   retFunction, d1, d2, c,
                   std::set<D>{IDESolver<N, D, M, V, I>::zeroValue});
@@ -633,17 +623,17 @@ public:
                            PAMM_SEVERITY_LEVEL::Full);
           IDESolver<N, D, M, V, I>::saveEdges(n, retSiteC, d2, targets, true);
           for (D d5 : targets) {
-            std::shared_ptr<EdgeFunction<V>> f5 =
+            EdgeFunctionPtr<V> f5 =
                 IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                     .getReturnEdgeFunction(
                         c, IDESolver<N, D, M, V, I>::icfg.getMethodOf(n), n, d2,
                         retSiteC, d5);
             INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << f5->str() << " * " << f->str());
+                          << "Compose: " << f5.str() << " * " << f.str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
             IDESolver<N, D, M, V, I>::propagteUnbalancedReturnFlow(
-                retSiteC, d5, f->composeWith(f5), c);
+                retSiteC, d5, f.composeWith(f5), c);
             // register for value processing (2nd IDE phase)
             IDESolver<N, D, M, V, I>::unbalancedRetSites.insert(retSiteC);
           }
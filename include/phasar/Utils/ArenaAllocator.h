@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_ARENAALLOCATOR_H_
+#define PHASAR_UTILS_ARENAALLOCATOR_H_
+
+#include <cstddef>
+
+namespace psr {
+
+class MonotonicArena;
+
+/**
+ * Allocates the given number of bytes from the arena, see
+ * MonotonicArena::allocate(). Allows to allocate from an arena whose type
+ * is incomplete.
+ */
+void *allocateFrom(MonotonicArena &Arena, size_t Bytes, size_t Alignment);
+
+/**
+ * A standard allocator that allocates from a MonotonicArena, e.g. for use
+ * with std::allocate_shared. Deallocation is a no-op, the memory is
+ * returned once the arena is destroyed. Only needs a declaration of the
+ * arena, such that headers may use it without including the arena.
+ */
+template <typename T> class ArenaAllocator {
+private:
+  MonotonicArena *Arena;
+
+public:
+  using value_type = T;
+
+  explicit ArenaAllocator(MonotonicArena *Arena) : Arena(Arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &Other) : Arena(Other.getArena()) {}
+
+  T *allocate(size_t N) {
+    return static_cast<T *>(allocateFrom(*Arena, N * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *P, size_t N) {}
+
+  MonotonicArena *getArena() const { return Arena; }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &A, const ArenaAllocator<U> &B) {
+  return A.getArena() == B.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &A, const ArenaAllocator<U> &B) {
+  return !(A == B);
+}
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_CACHEREGISTRY_H_
+#define PHASAR_UTILS_CACHEREGISTRY_H_
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
+
+namespace psr {
+
+/**
+ * A process-wide registry of caches that can be shared by several analyses
+ * of the same program, e.g. the flow and edge function caches of solvers
+ * that solve the same problem with different seeds.
+ *
+ * Each cache lives in a scope, e.g. an interprocedural CFG or an
+ * llvm::Module, and is identified by its type and a name. Since the caches
+ * are keyed by the addresses of their scopes, a scope must be released
+ * before it is destroyed; otherwise a new scope at the same address would
+ * see stale caches. LLVMBasedICFG and ProjectIRDB release themselves and
+ * their modules on destruction.
+ */
+class CacheRegistry {
+private:
+  using Key = std::tuple<const void *, std::type_index, std::string>;
+  std::map<Key, std::shared_ptr<void>> Caches;
+  mutable std::mutex Mtx;
+
+  CacheRegistry() = default;
+
+public:
+  CacheRegistry(const CacheRegistry &) = delete;
+  CacheRegistry &operator=(const CacheRegistry &) = delete;
+  CacheRegistry(CacheRegistry &&) = delete;
+  CacheRegistry &operator=(CacheRegistry &&) = delete;
+  ~CacheRegistry() = default;
+
+  static CacheRegistry &getInstance();
+
+  /**
+   * Returns the cache of type T with the given name in Scope. If there is no
+   * such cache yet, it is created by calling Create(), which must return a
+   * std::shared_ptr<T>.
+   */
+  template <typename T, typename Fn>
+  std::shared_ptr<T> getOrCreate(const void *Scope, const std::string &Name,
+                                 Fn Create) {
+    std::lock_guard<std::mutex> Lock(Mtx);
+    auto &Cache = Caches[Key(Scope, std::type_index(typeid(T)), Name)];
+    if (!Cache) {
+      Cache = Create();
+    }
+    return std::static_pointer_cast<T>(Cache);
+  }
+
+  /**
+   * Drops all caches of the given scope. Users that still hold one of the
+   * caches keep it alive, but it is no longer handed out.
+   */
+  void release(const void *Scope);
+
+  void clear();
+
+  size_t size() const;
+};
+
+} // namespace psr
+
+#endif
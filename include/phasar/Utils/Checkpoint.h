@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_CHECKPOINT_H_
+#define PHASAR_UTILS_CHECKPOINT_H_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <phasar/Utils/Interner.h>
+
+namespace psr {
+
+/**
+ * Writes a checkpoint, i.e. a versioned binary file that consists of
+ * integers and strings and is read back using CheckpointReader. Each
+ * distinct string is written once and referred to by its id afterwards.
+ * All integers are stored in the byte order of the writing machine.
+ *
+ * The checkpoint is written into a temporary file that replaces the file at
+ * the given path on commit(), such that a checkpoint that is interrupted
+ * while it is written does not destroy the previous one.
+ */
+class CheckpointWriter {
+private:
+  std::string Path;
+  std::string TmpPath;
+  std::ofstream File;
+  Interner<std::string> Strings;
+  bool Committed = false;
+
+public:
+  /**
+   * Starts a checkpoint in the given format version; throws
+   * std::ios_base::failure if it cannot be written.
+   */
+  CheckpointWriter(const std::string &Path, uint32_t Version);
+
+  /**
+   * Removes the temporary file unless the checkpoint has been committed.
+   */
+  ~CheckpointWriter();
+
+  CheckpointWriter(const CheckpointWriter &) = delete;
+
+  CheckpointWriter &operator=(const CheckpointWriter &) = delete;
+
+  void writeInt(uint64_t Value);
+
+  void writeString(const std::string &Str);
+
+  /**
+   * Replaces the file at the path by the checkpoint; throws
+   * std::ios_base::failure if the checkpoint could not be written.
+   */
+  void commit();
+};
+
+/**
+ * Reads a checkpoint that has been written by CheckpointWriter. The values
+ * must be read in the order in which they have been written.
+ */
+class CheckpointReader {
+private:
+  std::string Path;
+  std::ifstream File;
+  std::vector<std::string> Strings;
+
+  void check();
+
+public:
+  /**
+   * Opens the checkpoint at the given path; throws std::ios_base::failure
+   * if it cannot be read, is not a checkpoint or has been written in another
+   * format version.
+   */
+  CheckpointReader(const std::string &Path, uint32_t Version);
+
+  ~CheckpointReader() = default;
+
+  CheckpointReader(const CheckpointReader &) = delete;
+
+  CheckpointReader &operator=(const CheckpointReader &) = delete;
+
+  /**
+   * Reads the next integer; throws std::ios_base::failure if the
+   * checkpoint is truncated.
+   */
+  uint64_t readInt();
+
+  /**
+   * Reads the next string; throws std::ios_base::failure if the checkpoint
+   * is truncated or corrupt.
+   */
+  const std::string &readString();
+};
+
+/**
+ * Intercepts SIGTERM while it is alive, such that a long-running
+ * computation can save its state before the process terminates: the
+ * computation polls isPending() and calls forwardSignal() once its state is
+ * saved. Guards must be destroyed in the reverse order of their creation.
+ */
+class TerminationSignalGuard {
+private:
+  void (*PreviousHandler)(int);
+
+public:
+  TerminationSignalGuard();
+
+  /**
+   * Restores the signal handler that has been installed before.
+   */
+  ~TerminationSignalGuard();
+
+  TerminationSignalGuard(const TerminationSignalGuard &) = delete;
+
+  TerminationSignalGuard &operator=(const TerminationSignalGuard &) = delete;
+
+  /**
+   * Returns whether SIGTERM has been received.
+   */
+  static bool isPending();
+
+  /**
+   * Passes the received signal on to the signal handler that has been
+   * installed before, which terminates the process by default.
+   */
+  void forwardSignal();
+};
+
+} // namespace psr
+
+#endif
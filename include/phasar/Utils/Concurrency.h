@@ -0,0 +1,279 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_CONCURRENCY_H_
+#define PHASAR_UTILS_CONCURRENCY_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Maps a key to one of NumShards shards. The hash value is scrambled first,
+ * since std::hash is the identity for pointers whose lower bits are always
+ * zero due to alignment.
+ */
+template <typename K>
+inline size_t shardIndex(const K &Key, size_t NumShards) {
+  uint64_t H = std::hash<K>()(Key);
+  H ^= H >> 33;
+  H *= 0xff51afd7ed558ccdULL;
+  H ^= H >> 33;
+  return H % NumShards;
+}
+
+/**
+ * A non-owning, read-only view of an object that is guarded by a mutex. The
+ * mutex, if any, is held for the lifetime of the view; hence, the guarded
+ * object must not be modified through other means while the view is alive.
+ */
+template <typename T> class LockedView {
+private:
+  std::unique_lock<std::mutex> Lock;
+  const T *Obj;
+
+public:
+  LockedView(std::unique_lock<std::mutex> Lock, const T &Obj)
+      : Lock(std::move(Lock)), Obj(&Obj) {}
+
+  ~LockedView() = default;
+
+  LockedView(LockedView &&) = default;
+
+  LockedView &operator=(LockedView &&) = default;
+
+  const T &operator*() const { return *Obj; }
+
+  const T *operator->() const { return Obj; }
+
+  auto begin() const { return Obj->begin(); }
+
+  auto end() const { return Obj->end(); }
+
+  size_t size() const { return Obj->size(); }
+
+  bool empty() const { return Obj->empty(); }
+};
+
+/**
+ * A pool of work-stealing deques, one per worker thread. Workers push newly
+ * discovered items onto their own deque and pop from its back, which keeps
+ * related work on the same core. Idle workers steal from the front of the
+ * other workers' deques and block once there is nothing left to steal. run()
+ * returns as soon as all items, including the ones produced while
+ * processing, have been processed or the queue has been cancelled or
+ * interrupted.
+ *
+ * Items that are pushed by a thread that is not a worker of this queue, e.g.
+ * the initial items pushed before run() is called, end up in the first
+ * worker's deque.
+ */
+template <typename T> class WorkStealingQueue {
+private:
+  struct WorkerDeque {
+    std::mutex Mtx;
+    std::deque<T> Items;
+  };
+  std::vector<std::unique_ptr<WorkerDeque>> Deques;
+  // the worker index of each thread started by run(), only modified while no
+  // worker is running
+  std::unordered_map<std::thread::id, size_t> WorkerIndices;
+  // number of items that have been pushed but not yet completely processed
+  std::atomic<size_t> Pending{0};
+  // number of items that are stored in the deques
+  std::atomic<size_t> Queued{0};
+  std::atomic<bool> Cancelled{false};
+  std::atomic<bool> Interrupted{false};
+  // idle workers wait for new items or the end of run()
+  std::mutex IdleMtx;
+  std::condition_variable IdleCV;
+  std::atomic<size_t> IdleWorkers{0};
+  // number of failed attempts to pop an item before a worker blocks
+  static constexpr unsigned SpinsBeforeBlocking = 64;
+
+  size_t getWorkerIndex() const {
+    auto Search = WorkerIndices.find(std::this_thread::get_id());
+    return Search != WorkerIndices.end() ? Search->second : 0;
+  }
+
+  std::optional<T> tryPop(size_t Self) {
+    {
+      WorkerDeque &Own = *Deques[Self];
+      std::lock_guard<std::mutex> Lock(Own.Mtx);
+      if (!Own.Items.empty()) {
+        T Item = std::move(Own.Items.back());
+        Own.Items.pop_back();
+        Queued.fetch_sub(1);
+        return Item;
+      }
+    }
+    for (size_t I = 1; I < Deques.size(); ++I) {
+      WorkerDeque &Victim = *Deques[(Self + I) % Deques.size()];
+      std::lock_guard<std::mutex> Lock(Victim.Mtx);
+      if (!Victim.Items.empty()) {
+        T Item = std::move(Victim.Items.front());
+        Victim.Items.pop_front();
+        Queued.fetch_sub(1);
+        return Item;
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool isStopped() const { return Cancelled.load() || Interrupted.load(); }
+
+  void wakeAll() {
+    std::lock_guard<std::mutex> Lock(IdleMtx);
+    IdleCV.notify_all();
+  }
+
+  // Blocks the calling worker until an item may be available or run() has
+  // to return.
+  void waitForWork() {
+    std::unique_lock<std::mutex> Lock(IdleMtx);
+    IdleWorkers.fetch_add(1);
+    IdleCV.wait(Lock, [this]() {
+      return Queued.load() > 0 || Pending.load() == 0 || isStopped();
+    });
+    IdleWorkers.fetch_sub(1);
+  }
+
+public:
+  WorkStealingQueue(size_t NumWorkers) {
+    for (size_t I = 0; I < std::max<size_t>(NumWorkers, 1); ++I) {
+      Deques.push_back(std::make_unique<WorkerDeque>());
+    }
+  }
+
+  ~WorkStealingQueue() = default;
+
+  WorkStealingQueue(const WorkStealingQueue &) = delete;
+
+  WorkStealingQueue &operator=(const WorkStealingQueue &) = delete;
+
+  size_t getNumWorkers() const { return Deques.size(); }
+
+  bool empty() const { return Pending.load() == 0; }
+
+  /**
+   * Pushes an item onto the deque of the calling worker.
+   */
+  void push(T Item) {
+    Pending.fetch_add(1);
+    {
+      WorkerDeque &Own = *Deques[getWorkerIndex()];
+      std::lock_guard<std::mutex> Lock(Own.Mtx);
+      Own.Items.push_back(std::move(Item));
+      Queued.fetch_add(1);
+    }
+    if (IdleWorkers.load() > 0) {
+      std::lock_guard<std::mutex> Lock(IdleMtx);
+      IdleCV.notify_one();
+    }
+  }
+
+  /**
+   * Starts one thread per worker that applies Process to the queued items
+   * until no more work is left. Process may push new items.
+   */
+  template <typename Fn> void run(Fn Process) {
+    std::vector<std::thread> Workers;
+    // the workers must not look up their indices before all are registered
+    std::atomic<bool> Registered{false};
+    for (size_t I = 0; I < Deques.size(); ++I) {
+      Workers.emplace_back([this, I, &Process, &Registered]() {
+        while (!Registered.load()) {
+          std::this_thread::yield();
+        }
+        unsigned Spins = 0;
+        while (!isStopped()) {
+          if (std::optional<T> Item = tryPop(I)) {
+            Spins = 0;
+            Process(std::move(*Item));
+            // decrement only after Process has pushed its successors
+            if (Pending.fetch_sub(1) == 1) {
+              wakeAll();
+            }
+          } else if (Pending.load() == 0) {
+            break;
+          } else if (++Spins < SpinsBeforeBlocking) {
+            std::this_thread::yield();
+          } else {
+            Spins = 0;
+            waitForWork();
+          }
+        }
+        if (isStopped()) {
+          wakeAll();
+        }
+      });
+      WorkerIndices[Workers.back().get_id()] = I;
+    }
+    Registered.store(true);
+    for (auto &Worker : Workers) {
+      Worker.join();
+    }
+    WorkerIndices.clear();
+    if (Cancelled.load()) {
+      for (auto &Deque : Deques) {
+        Deque->Items.clear();
+      }
+      Pending.store(0);
+      Queued.store(0);
+      Cancelled.store(false);
+    }
+    Interrupted.store(false);
+  }
+
+  /**
+   * Makes run() return as soon as the workers have finished the items they
+   * are currently processing. All remaining items are discarded.
+   */
+  void cancel() {
+    Cancelled.store(true);
+    wakeAll();
+  }
+
+  /**
+   * Makes run() return as soon as the workers have finished the items they
+   * are currently processing. The remaining items are kept, such that they
+   * can be inspected using foreachItem() before run() is called again.
+   */
+  void interrupt() {
+    Interrupted.store(true);
+    wakeAll();
+  }
+
+  /**
+   * Calls F for every queued item. Must not be called while run() is
+   * running.
+   */
+  template <typename Fn> void foreachItem(Fn F) const {
+    for (const auto &Deque : Deques) {
+      for (const T &Item : Deque->Items) {
+        F(Item);
+      }
+    }
+  }
+};
+
+} // namespace psr
+
+#endif
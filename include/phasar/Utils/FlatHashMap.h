@@ -0,0 +1,243 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_FLATHASHMAP_H_
+#define PHASAR_UTILS_FLATHASHMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Combines the std::hash values of all elements of a tuple. Can be used as
+ * the hash function of maps that are keyed by tuples.
+ */
+struct TupleHash {
+  template <typename... Ts>
+  size_t operator()(const std::tuple<Ts...> &T) const {
+    return std::apply(
+        [](const Ts &... Elems) {
+          size_t Seed = 0;
+          ((Seed ^= std::hash<Ts>()(Elems) + 0x9e3779b9 + (Seed << 6) +
+                    (Seed >> 2)),
+           ...);
+          return Seed;
+        },
+        T);
+  }
+};
+
+/**
+ * An open-addressing hash map with linear probing. All entries are stored in
+ * a single contiguous array, together with the hash value of their key. A
+ * lookup therefore touches one region of memory and only compares keys whose
+ * hash values are equal. Erasing uses backward shifting, so no tombstones
+ * are left behind.
+ *
+ * Keys and values must be default constructible. Pointers to values are
+ * invalidated by insertions and erasures.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class FlatHashMap {
+private:
+  struct Slot {
+    // zero marks an empty slot
+    size_t HashValue = 0;
+    K Key{};
+    V Value{};
+  };
+
+  std::vector<Slot> Slots;
+  size_t Size = 0;
+  Hash Hasher;
+  KeyEqual Equal;
+
+  size_t hashOf(const K &Key) const {
+    // std::hash is the identity for pointers and integers, whose low bits
+    // are poorly distributed, hence mix the bits before masking
+    uint64_t H = static_cast<uint64_t>(Hasher(Key));
+    H ^= H >> 33;
+    H *= 0xff51afd7ed558ccdULL;
+    H ^= H >> 33;
+    return H == 0 ? 1 : static_cast<size_t>(H);
+  }
+
+  size_t mask() const { return Slots.size() - 1; }
+
+  // Returns the index of the slot holding Key, or the index of the empty
+  // slot at which it would be inserted. Requires a non-empty slot array.
+  size_t probe(const K &Key, size_t HashValue) const {
+    size_t Idx = HashValue & mask();
+    while (Slots[Idx].HashValue != 0 &&
+           (Slots[Idx].HashValue != HashValue || !Equal(Slots[Idx].Key, Key))) {
+      Idx = (Idx + 1) & mask();
+    }
+    return Idx;
+  }
+
+  void rehash(size_t NewCapacity) {
+    std::vector<Slot> Old(NewCapacity);
+    Old.swap(Slots);
+    for (auto &S : Old) {
+      if (S.HashValue != 0) {
+        size_t Idx = S.HashValue & mask();
+        while (Slots[Idx].HashValue != 0) {
+          Idx = (Idx + 1) & mask();
+        }
+        Slots[Idx] = std::move(S);
+      }
+    }
+  }
+
+  void eraseAt(size_t Idx) {
+    // shift back the entries of the probe sequence that follows Idx
+    size_t Next = (Idx + 1) & mask();
+    while (Slots[Next].HashValue != 0) {
+      size_t Home = Slots[Next].HashValue & mask();
+      if (((Next - Home) & mask()) >= ((Next - Idx) & mask())) {
+        Slots[Idx] = std::move(Slots[Next]);
+        Idx = Next;
+      }
+      Next = (Next + 1) & mask();
+    }
+    Slots[Idx] = Slot();
+    --Size;
+  }
+
+public:
+  FlatHashMap() = default;
+
+  ~FlatHashMap() = default;
+
+  FlatHashMap(const FlatHashMap &) = default;
+
+  FlatHashMap &operator=(const FlatHashMap &) = default;
+
+  FlatHashMap(FlatHashMap &&) = default;
+
+  FlatHashMap &operator=(FlatHashMap &&) = default;
+
+  /**
+   * Returns a pointer to the value of Key, nullptr if Key is not contained.
+   */
+  V *find(const K &Key) {
+    if (Size == 0) {
+      return nullptr;
+    }
+    size_t Idx = probe(Key, hashOf(Key));
+    return Slots[Idx].HashValue != 0 ? &Slots[Idx].Value : nullptr;
+  }
+
+  const V *find(const K &Key) const {
+    return const_cast<FlatHashMap *>(this)->find(Key);
+  }
+
+  /**
+   * Inserts Value for Key if Key is not yet contained. Returns a pointer to
+   * the value stored for Key and whether an insertion took place.
+   */
+  std::pair<V *, bool> insert(const K &Key, V Value) {
+    // keep the load factor at or below 3/4
+    if (4 * (Size + 1) > 3 * Slots.size()) {
+      rehash(Slots.empty() ? 16 : 2 * Slots.size());
+    }
+    size_t HashValue = hashOf(Key);
+    size_t Idx = probe(Key, HashValue);
+    if (Slots[Idx].HashValue != 0) {
+      return {&Slots[Idx].Value, false};
+    }
+    Slots[Idx].HashValue = HashValue;
+    Slots[Idx].Key = Key;
+    Slots[Idx].Value = std::move(Value);
+    ++Size;
+    return {&Slots[Idx].Value, true};
+  }
+
+  /**
+   * Removes Key and returns whether it was contained.
+   */
+  bool erase(const K &Key) {
+    if (Size == 0) {
+      return false;
+    }
+    size_t Idx = probe(Key, hashOf(Key));
+    if (Slots[Idx].HashValue == 0) {
+      return false;
+    }
+    eraseAt(Idx);
+    return true;
+  }
+
+  /**
+   * Removes all entries for which P(Key, Value) returns true and returns
+   * their number.
+   */
+  template <typename Pred> size_t eraseIf(Pred P) {
+    size_t Erased = 0;
+    for (size_t Idx = 0; Idx < Slots.size();) {
+      if (Slots[Idx].HashValue != 0 && P(Slots[Idx].Key, Slots[Idx].Value)) {
+        // another entry may have been shifted into Idx
+        eraseAt(Idx);
+        ++Erased;
+      } else {
+        ++Idx;
+      }
+    }
+    return Erased;
+  }
+
+  /**
+   * Visits the entries in slot order, starting at slot Hand and wrapping
+   * around, and removes the first entry for which P(Key, Value) returns true.
+   * Hand is left at the removed slot, such that repeated calls continue where
+   * the previous one stopped, as required by CLOCK replacement. Gives up
+   * after two rounds and returns whether an entry has been removed.
+   */
+  template <typename Pred> bool eraseNextIf(size_t &Hand, Pred P) {
+    for (size_t Step = 0; Size != 0 && Step < 2 * Slots.size(); ++Step) {
+      Hand &= mask();
+      if (Slots[Hand].HashValue != 0 && P(Slots[Hand].Key, Slots[Hand].Value)) {
+        eraseAt(Hand);
+        return true;
+      }
+      ++Hand;
+    }
+    return false;
+  }
+
+  /**
+   * Calls F(Key, Value) for every entry in unspecified order.
+   */
+  template <typename Fn> void forEach(Fn F) const {
+    for (const auto &S : Slots) {
+      if (S.HashValue != 0) {
+        F(S.Key, S.Value);
+      }
+    }
+  }
+
+  size_t size() const { return Size; }
+
+  bool empty() const { return Size == 0; }
+
+  void clear() {
+    Slots.clear();
+    Size = 0;
+  }
+};
+
+} // namespace psr
+
+#endif
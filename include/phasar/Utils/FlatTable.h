@@ -0,0 +1,349 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_FLATTABLE_H_
+#define PHASAR_UTILS_FLATTABLE_H_
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <phasar/Utils/FlatHashMap.h>
+
+namespace psr {
+
+/**
+ * A two-key table that stores all of its cells in a single contiguous array.
+ *
+ * Unlike Table, which nests one hash map per row into another hash map, each
+ * cell is located by a single lookup in an open-addressing index keyed by the
+ * pair of row and column key. The cells of a row are chained into a list, such
+ * that row queries only visit the cells of the row. If requested at
+ * construction time, the cells of a column are chained as well; otherwise
+ * column queries scan all cells.
+ *
+ * The cells can be iterated directly, without building a copy of the table
+ * first. Removing a cell moves the last cell into its place, hence references
+ * to cells and values are invalidated by insertions and removals. Row and
+ * column keys must be default constructible; a table holds at most 2^32 - 1
+ * cells.
+ */
+template <typename R, typename C, typename V> class FlatTable {
+public:
+  struct Cell {
+    R r;
+    C c;
+    V v;
+    Cell() = default;
+    ~Cell() = default;
+    Cell(const Cell &) = default;
+    Cell &operator=(const Cell &) = default;
+    Cell(Cell &&) = default;
+    Cell &operator=(Cell &&) = default;
+    Cell(R row, C col, V val) : r(row), c(col), v(std::move(val)) {}
+    R getRowKey() const { return r; }
+    C getColumnKey() const { return c; }
+    V getValue() const { return v; }
+    friend std::ostream &operator<<(std::ostream &os, const Cell &c) {
+      return os << "Cell: " << c.r << ", " << c.c << ", " << c.v;
+    }
+    friend bool operator<(const Cell &lhs, const Cell &rhs) {
+      return std::tie(lhs.r, lhs.c, lhs.v) < std::tie(rhs.r, rhs.c, rhs.v);
+    }
+    friend bool operator==(const Cell &lhs, const Cell &rhs) {
+      return std::tie(lhs.r, lhs.c, lhs.v) == std::tie(rhs.r, rhs.c, rhs.v);
+    }
+  };
+
+  using const_iterator = typename std::vector<Cell>::const_iterator;
+
+private:
+  static constexpr uint32_t None = std::numeric_limits<uint32_t>::max();
+
+  // doubly linked lists of the cells of a row and of a column
+  struct Links {
+    uint32_t PrevInRow = None;
+    uint32_t NextInRow = None;
+    uint32_t PrevInColumn = None;
+    uint32_t NextInColumn = None;
+  };
+
+  std::vector<Cell> Cells;
+  std::vector<Links> CellLinks;
+  FlatHashMap<std::tuple<R, C>, uint32_t, TupleHash> Index;
+  FlatHashMap<R, uint32_t> RowHeads;
+  FlatHashMap<C, uint32_t> ColumnHeads;
+  bool IndexColumns = false;
+
+  void link(uint32_t Idx) {
+    auto Row = RowHeads.insert(Cells[Idx].r, Idx);
+    if (!Row.second) {
+      CellLinks[Idx].NextInRow = *Row.first;
+      CellLinks[*Row.first].PrevInRow = Idx;
+      *Row.first = Idx;
+    }
+    if (IndexColumns) {
+      auto Column = ColumnHeads.insert(Cells[Idx].c, Idx);
+      if (!Column.second) {
+        CellLinks[Idx].NextInColumn = *Column.first;
+        CellLinks[*Column.first].PrevInColumn = Idx;
+        *Column.first = Idx;
+      }
+    }
+  }
+
+  void unlink(uint32_t Idx) {
+    const Links &L = CellLinks[Idx];
+    if (L.PrevInRow != None) {
+      CellLinks[L.PrevInRow].NextInRow = L.NextInRow;
+    } else if (L.NextInRow != None) {
+      *RowHeads.find(Cells[Idx].r) = L.NextInRow;
+    } else {
+      RowHeads.erase(Cells[Idx].r);
+    }
+    if (L.NextInRow != None) {
+      CellLinks[L.NextInRow].PrevInRow = L.PrevInRow;
+    }
+    if (!IndexColumns) {
+      return;
+    }
+    if (L.PrevInColumn != None) {
+      CellLinks[L.PrevInColumn].NextInColumn = L.NextInColumn;
+    } else if (L.NextInColumn != None) {
+      *ColumnHeads.find(Cells[Idx].c) = L.NextInColumn;
+    } else {
+      ColumnHeads.erase(Cells[Idx].c);
+    }
+    if (L.NextInColumn != None) {
+      CellLinks[L.NextInColumn].PrevInColumn = L.PrevInColumn;
+    }
+  }
+
+  // moves the cell at From into the unlinked slot To
+  void relocate(uint32_t From, uint32_t To) {
+    Cells[To] = std::move(Cells[From]);
+    CellLinks[To] = CellLinks[From];
+    const Links &L = CellLinks[To];
+    if (L.PrevInRow != None) {
+      CellLinks[L.PrevInRow].NextInRow = To;
+    } else {
+      *RowHeads.find(Cells[To].r) = To;
+    }
+    if (L.NextInRow != None) {
+      CellLinks[L.NextInRow].PrevInRow = To;
+    }
+    if (IndexColumns) {
+      if (L.PrevInColumn != None) {
+        CellLinks[L.PrevInColumn].NextInColumn = To;
+      } else {
+        *ColumnHeads.find(Cells[To].c) = To;
+      }
+      if (L.NextInColumn != None) {
+        CellLinks[L.NextInColumn].PrevInColumn = To;
+      }
+    }
+    *Index.find(std::make_tuple(Cells[To].r, Cells[To].c)) = To;
+  }
+
+public:
+  FlatTable() = default;
+
+  /**
+   * Creates an empty table. If IndexColumns is true, the cells of each column
+   * are indexed as well, which speeds up column queries at the cost of some
+   * memory and slower insertions.
+   */
+  explicit FlatTable(bool IndexColumns) : IndexColumns(IndexColumns) {}
+
+  ~FlatTable() = default;
+
+  FlatTable(const FlatTable &) = default;
+
+  FlatTable(FlatTable &&) = default;
+
+  FlatTable &operator=(const FlatTable &) = default;
+
+  FlatTable &operator=(FlatTable &&) = default;
+
+  /**
+   * Associates v with the given keys, replacing a previous value, and returns
+   * a reference to the stored value.
+   */
+  V &insert(R r, C c, V v) {
+    V &Value = get(r, c);
+    Value = std::move(v);
+    return Value;
+  }
+
+  /**
+   * Returns the value associated with the given keys. A default constructed
+   * value is inserted if there is none.
+   */
+  V &get(R r, C c) {
+    auto Search = Index.insert(std::make_tuple(r, c),
+                               static_cast<uint32_t>(Cells.size()));
+    if (!Search.second) {
+      return Cells[*Search.first].v;
+    }
+    Cells.emplace_back(r, c, V());
+    CellLinks.emplace_back();
+    link(static_cast<uint32_t>(Cells.size() - 1));
+    return Cells.back().v;
+  }
+
+  /**
+   * Returns a pointer to the value associated with the given keys, nullptr if
+   * there is none.
+   */
+  V *find(R r, C c) {
+    uint32_t *Idx = Index.find(std::make_tuple(r, c));
+    return Idx ? &Cells[*Idx].v : nullptr;
+  }
+
+  const V *find(R r, C c) const {
+    return const_cast<FlatTable *>(this)->find(r, c);
+  }
+
+  bool contains(R r, C c) const { return find(r, c) != nullptr; }
+
+  bool containsRow(R r) const { return RowHeads.find(r) != nullptr; }
+
+  bool containsColumn(C c) const {
+    if (IndexColumns) {
+      return ColumnHeads.find(c) != nullptr;
+    }
+    for (const Cell &Entry : Cells) {
+      if (Entry.c == c) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Removes the value associated with the given keys and returns whether
+   * there was one.
+   */
+  bool remove(R r, C c) {
+    auto Key = std::make_tuple(r, c);
+    uint32_t *Search = Index.find(Key);
+    if (!Search) {
+      return false;
+    }
+    uint32_t Idx = *Search;
+    unlink(Idx);
+    Index.erase(Key);
+    uint32_t Last = static_cast<uint32_t>(Cells.size() - 1);
+    if (Idx != Last) {
+      relocate(Last, Idx);
+    }
+    Cells.pop_back();
+    CellLinks.pop_back();
+    return true;
+  }
+
+  /**
+   * Calls F(c, v) for every cell of row r.
+   */
+  template <typename Fn> void foreachInRow(R r, Fn F) const {
+    const uint32_t *Head = RowHeads.find(r);
+    for (uint32_t Idx = Head ? *Head : None; Idx != None;
+         Idx = CellLinks[Idx].NextInRow) {
+      F(Cells[Idx].c, Cells[Idx].v);
+    }
+  }
+
+  /**
+   * Calls F(r, v) for every cell of column c. Visits all cells of the table
+   * unless the columns are indexed.
+   */
+  template <typename Fn> void foreachInColumn(C c, Fn F) const {
+    if (!IndexColumns) {
+      for (const Cell &Entry : Cells) {
+        if (Entry.c == c) {
+          F(Entry.r, Entry.v);
+        }
+      }
+      return;
+    }
+    const uint32_t *Head = ColumnHeads.find(c);
+    for (uint32_t Idx = Head ? *Head : None; Idx != None;
+         Idx = CellLinks[Idx].NextInColumn) {
+      F(Cells[Idx].r, Cells[Idx].v);
+    }
+  }
+
+  /**
+   * Calls F(r, c, v) for every cell of the table.
+   */
+  template <typename Fn> void foreachCell(Fn F) const {
+    for (const Cell &Entry : Cells) {
+      F(Entry.r, Entry.c, Entry.v);
+    }
+  }
+
+  /**
+   * Returns a copy of all mappings that have the given row key.
+   */
+  std::unordered_map<C, V> row(R r) const {
+    std::unordered_map<C, V> Row;
+    foreachInRow(r, [&Row](const C &c, const V &v) { Row.emplace(c, v); });
+    return Row;
+  }
+
+  /**
+   * Returns a copy of all mappings that have the given column key.
+   */
+  std::unordered_map<R, V> column(C c) const {
+    std::unordered_map<R, V> Column;
+    foreachInColumn(
+        c, [&Column](const R &r, const V &v) { Column.emplace(r, v); });
+    return Column;
+  }
+
+  /**
+   * Returns a copy of all cells. Prefer iterating the table if no copy is
+   * required.
+   */
+  std::vector<Cell> cellVec() const { return Cells; }
+
+  const_iterator begin() const { return Cells.begin(); }
+
+  const_iterator end() const { return Cells.end(); }
+
+  /**
+   * Returns the number of cells.
+   */
+  size_t size() const { return Cells.size(); }
+
+  bool empty() const { return Cells.empty(); }
+
+  void clear() {
+    Cells.clear();
+    CellLinks.clear();
+    Index.clear();
+    RowHeads.clear();
+    ColumnHeads.clear();
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const FlatTable &t) {
+    for (const Cell &Entry : t.Cells) {
+      os << "< " << Entry.r << " , " << Entry.c << " , " << Entry.v << " >\n";
+    }
+    return os;
+  }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_INTERNER_H_
+#define PHASAR_UTILS_INTERNER_H_
+
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include <phasar/Utils/FlatHashMap.h>
+
+namespace psr {
+
+/**
+ * Maps objects, e.g. statements or data-flow facts, to dense 32 bit ids in
+ * the order in which they are first seen. The ids can be used as compact
+ * keys or as indices into flat arrays. If constructed as concurrent, the
+ * interner may be used by multiple threads at the same time; otherwise it
+ * takes no locks at all.
+ */
+template <typename T> class Interner {
+public:
+  using Id = uint32_t;
+
+private:
+  FlatHashMap<T, Id> Ids;
+  std::vector<T> Objects;
+  bool Concurrent;
+  mutable std::shared_mutex Mtx;
+
+  std::shared_lock<std::shared_mutex> readLock() const {
+    return Concurrent ? std::shared_lock<std::shared_mutex>(Mtx)
+                      : std::shared_lock<std::shared_mutex>();
+  }
+
+  std::unique_lock<std::shared_mutex> writeLock() const {
+    return Concurrent ? std::unique_lock<std::shared_mutex>(Mtx)
+                      : std::unique_lock<std::shared_mutex>();
+  }
+
+public:
+  Interner(bool Concurrent = false) : Concurrent(Concurrent) {}
+
+  ~Interner() = default;
+
+  Interner(const Interner &) = delete;
+
+  Interner &operator=(const Interner &) = delete;
+
+  /**
+   * Returns the id of Obj. Obj is assigned the next free id if it has not
+   * been seen before.
+   */
+  Id getId(const T &Obj) {
+    if (Concurrent) {
+      auto Lock = readLock();
+      if (const Id *Search = Ids.find(Obj)) {
+        return *Search;
+      }
+    }
+    auto Lock = writeLock();
+    auto Inserted = Ids.insert(Obj, static_cast<Id>(Objects.size()));
+    if (Inserted.second) {
+      Objects.push_back(Obj);
+    }
+    return *Inserted.first;
+  }
+
+  /**
+   * Returns the id of Obj without assigning a new one, std::nullopt if Obj
+   * has not been seen before.
+   */
+  std::optional<Id> findId(const T &Obj) const {
+    auto Lock = readLock();
+    if (const Id *Search = Ids.find(Obj)) {
+      return *Search;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * Returns the object that has been assigned the given id.
+   */
+  T get(Id ObjId) const {
+    auto Lock = readLock();
+    assert(ObjId < Objects.size() && "unknown id");
+    return Objects[ObjId];
+  }
+
+  size_t size() const {
+    auto Lock = readLock();
+    return Objects.size();
+  }
+
+  void clear() {
+    auto Lock = writeLock();
+    Ids.clear();
+    Objects.clear();
+  }
+};
+
+/**
+ * Combines two interned ids into a single key.
+ */
+inline uint64_t packIds(uint32_t High, uint32_t Low) {
+  return (static_cast<uint64_t>(High) << 32) | Low;
+}
+
+} // namespace psr
+
+#endif
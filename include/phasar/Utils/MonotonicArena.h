@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_MONOTONICARENA_H_
+#define PHASAR_UTILS_MONOTONICARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <phasar/Utils/ArenaAllocator.h>
+
+namespace psr {
+
+/**
+ * An allocator that hands out memory by bumping a pointer into large chunks
+ * and never frees individual allocations; all memory is returned at once
+ * when the arena is destroyed. Objects allocated from the arena are still
+ * destroyed as usual, only their memory is not reused. The chunks grow
+ * geometrically, starting at InitialSize bytes.
+ *
+ * The arena is thread-safe. It consists of NumShards independent sequences
+ * of chunks, each guarded by its own mutex, and threads allocate from the
+ * shard their id maps to, such that concurrent allocations rarely contend.
+ */
+class MonotonicArena {
+private:
+  struct Shard {
+    std::mutex Mtx;
+    std::vector<std::unique_ptr<char[]>> Chunks;
+    // the free part of the current chunk
+    char *Cur = nullptr;
+    char *End = nullptr;
+    size_t NextChunkSize;
+    size_t BytesAllocated = 0;
+
+    Shard(size_t InitialSize) : NextChunkSize(InitialSize) {}
+  };
+  std::vector<std::unique_ptr<Shard>> Shards;
+
+public:
+  explicit MonotonicArena(size_t NumShards = 1, size_t InitialSize = 4096);
+
+  ~MonotonicArena() = default;
+
+  MonotonicArena(const MonotonicArena &) = delete;
+
+  MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+  /**
+   * Returns Bytes bytes of memory that are aligned to Alignment, which must
+   * be a power of two. The memory stays valid until the arena is destroyed.
+   */
+  void *allocate(size_t Bytes, size_t Alignment = alignof(std::max_align_t));
+
+  /**
+   * Returns the number of bytes that have been requested from the arena.
+   */
+  size_t getBytesAllocated() const;
+
+  /**
+   * Like std::make_shared, but allocates the object and its control block
+   * from the arena. The arena must outlive all copies of the pointer.
+   */
+  template <typename T, typename... ArgTs>
+  std::shared_ptr<T> makeShared(ArgTs &&... Args) {
+    return std::allocate_shared<T>(ArenaAllocator<T>(this),
+                                   std::forward<ArgTs>(Args)...);
+  }
+};
+
+} // namespace psr
+
+#endif
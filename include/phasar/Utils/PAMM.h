@@ -17,8 +17,10 @@
 #ifndef PHASAR_UTILS_PAMM_H_
 #define PHASAR_UTILS_PAMM_H_
 
+#include <atomic>        // atomic
 #include <chrono>        // high_resolution_clock::time_point, milliseconds
 #include <iosfwd>        // ostream
+#include <mutex>         // mutex
 #include <set>           // set
 #include <string>        // string
 #include <unordered_map> // unordered_map
@@ -60,10 +62,14 @@ private:
   std::unordered_map<std::string,
                      std::vector<std::pair<TimePoint_t, TimePoint_t>>>
       RepeatingTimer;
-  std::unordered_map<std::string, unsigned> Counter;
+  // counters are updated atomically, such that they may be incremented and
+  // decremented by multiple threads once they have been registered
+  std::unordered_map<std::string, std::atomic<unsigned>> Counter;
+  std::mutex CounterMtx;
   std::unordered_map<std::string,
                      std::unordered_map<std::string, unsigned long>>
       Histogram;
+  std::mutex HistogramMtx;
 
 public:
   /// PAMM is used as singleton.
@@ -149,6 +155,8 @@ public:
    * @brief Registers a new counter under the given counter id - associated
    * macro: REG_COUNTER(COUNTER_ID, INIT_VALUE, SEV_LVL).
    * @param CounterId Unique counter id.
+   * @note Registering an existing counter keeps its current count. Counters
+   * must be registered before multiple threads use them.
    */
   void regCounter(const std::string &CounterId, unsigned IntialValue = 0);
 
@@ -189,6 +197,7 @@ public:
    * @brief Registers a new histogram - associated macro:
    * REG_HISTOGRAM(HISTOGRAM_ID, SEV_LVL).
    * @param HistogramId Unique hitogram id.
+   * @note Registering an existing histogram keeps its data points.
    */
   void regHistogram(const std::string &HistogramId);
 
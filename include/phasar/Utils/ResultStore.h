@@ -0,0 +1,217 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_RESULTSTORE_H_
+#define PHASAR_UTILS_RESULTSTORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <phasar/Utils/Interner.h>
+
+namespace psr {
+
+/**
+ * Layout of the binary result store files that are written by
+ * ResultStoreWriter and read by ResultStore. All integers are stored in the
+ * byte order of the writing machine.
+ *
+ * A file starts with the header, followed by the result records, i.e. pairs
+ * of fact and value ids, of all nodes. The records of a node are sorted by
+ * their fact ids, the nodes of a function are stored consecutively. The
+ * tables of functions, nodes and facts, the indices that sort them by name
+ * and the string table follow the records. Names and values refer to the
+ * string table by their string ids.
+ */
+namespace resultstore {
+
+constexpr char Magic[8] = {'P', 'S', 'R', 'R', 'E', 'S', 'U', 'L'};
+constexpr uint32_t Version = 1;
+
+struct Header {
+  char Magic[8];
+  uint32_t Version;
+  uint32_t NumFunctions;
+  uint32_t NumNodes;
+  uint32_t NumFacts;
+  uint32_t NumStrings;
+  uint32_t Reserved;
+  uint64_t NumRecords;
+  uint64_t RecordsOffset;
+  uint64_t FunctionsOffset;
+  uint64_t FunctionsByNameOffset;
+  uint64_t NodesOffset;
+  uint64_t NodesByNameOffset;
+  uint64_t FactsOffset;
+  uint64_t FactsByNameOffset;
+  uint64_t StringOffsetsOffset;
+  uint64_t StringDataOffset;
+};
+
+struct Record {
+  uint32_t Fact;
+  uint32_t Value;
+};
+
+struct Function {
+  uint32_t Name;
+  uint32_t FirstNode;
+  uint32_t NumNodes;
+  uint32_t Reserved;
+};
+
+struct Node {
+  uint32_t Name;
+  uint32_t Function;
+  uint32_t NumRecords;
+  uint32_t Reserved;
+  uint64_t FirstRecord;
+};
+
+} // namespace resultstore
+
+/**
+ * Writes the results of an analysis into a binary result store file. The
+ * results are streamed function by function and node by node: the records
+ * are written to the file right away, only the names are kept in memory
+ * until finish() writes the tables.
+ */
+class ResultStoreWriter {
+private:
+  std::ofstream File;
+  std::string Path;
+  Interner<std::string> Strings;
+  Interner<std::string> NodeNames;
+  Interner<std::string> FactNames;
+  std::vector<resultstore::Function> Functions;
+  std::vector<resultstore::Node> Nodes;
+  std::vector<uint32_t> FactStrings;
+  // records of the current node, which are sorted before they are written
+  std::vector<resultstore::Record> PendingRecords;
+  uint64_t NumRecords = 0;
+  bool Finished = false;
+
+  void flushNode();
+
+public:
+  /**
+   * Creates the file at the given path; throws std::ios_base::failure if it
+   * cannot be written.
+   */
+  explicit ResultStoreWriter(const std::string &Path);
+
+  /**
+   * Finishes the file unless finish() has been called already.
+   */
+  ~ResultStoreWriter();
+
+  ResultStoreWriter(const ResultStoreWriter &) = delete;
+
+  ResultStoreWriter &operator=(const ResultStoreWriter &) = delete;
+
+  /**
+   * Starts the section of the given function; the nodes added afterwards
+   * belong to it.
+   */
+  void beginFunction(const std::string &Name);
+
+  /**
+   * Starts the results of the given node, which must not have been added
+   * before.
+   */
+  void beginNode(const std::string &Name);
+
+  /**
+   * Adds the value of the given fact at the current node.
+   */
+  void addResult(const std::string &Fact, const std::string &Value);
+
+  /**
+   * Writes the tables and the header; no results can be added afterwards.
+   */
+  void finish();
+};
+
+/**
+ * Provides random access to the results in a binary result store file. The
+ * file is mapped into memory rather than read, hence opening even large
+ * stores is cheap, and the returned names and values refer into the
+ * mapping, i.e. they are valid as long as the store exists.
+ */
+class ResultStore {
+private:
+  const char *Data = nullptr;
+  size_t Size = 0;
+  const resultstore::Header *Hdr = nullptr;
+
+  template <typename T> const T *table(uint64_t Offset) const {
+    return reinterpret_cast<const T *>(Data + Offset);
+  }
+  std::optional<uint32_t> findByName(uint64_t ByNameOffset, uint32_t Count,
+                                     uint64_t NamesOffset, size_t Stride,
+                                     std::string_view Name) const;
+  std::optional<uint32_t> findNode(std::string_view Name) const;
+  std::optional<uint32_t> findFact(std::string_view Name) const;
+
+public:
+  /**
+   * Maps the file at the given path into memory; throws
+   * std::ios_base::failure if it cannot be read or is not a result store.
+   */
+  explicit ResultStore(const std::string &Path);
+
+  ~ResultStore();
+
+  ResultStore(const ResultStore &) = delete;
+
+  ResultStore &operator=(const ResultStore &) = delete;
+
+  /**
+   * Returns the string with the given id.
+   */
+  std::string_view getString(uint32_t Id) const;
+
+  /**
+   * Returns the value of the given fact at the given node, std::nullopt if
+   * there is none.
+   */
+  std::optional<std::string_view> resultAt(std::string_view Node,
+                                           std::string_view Fact) const;
+
+  /**
+   * Returns the facts and their values at the given node.
+   */
+  std::vector<std::pair<std::string_view, std::string_view>>
+  resultsAt(std::string_view Node) const;
+
+  /**
+   * Returns the names of all functions in the order they have been written.
+   */
+  std::vector<std::string_view> functions() const;
+
+  /**
+   * Returns the names of the nodes of the given function.
+   */
+  std::vector<std::string_view> nodesOf(std::string_view Function) const;
+
+  /**
+   * Returns the number of results, i.e. of node, fact and value triples.
+   */
+  size_t size() const { return Hdr->NumRecords; }
+};
+
+} // namespace psr
+
+#endif
@@ -103,6 +103,16 @@ public:
     return v;
   }
 
+  template <typename Fn> void foreachCell(Fn F) const {
+    // Applies F to all row key / column key / value triplets without copying
+    // them.
+    for (auto &m1 : table) {
+      for (auto &m2 : m1.second) {
+        F(m1.first, m2.first, m2.second);
+      }
+    }
+  }
+
   std::unordered_map<R, V> column(C columnKey) {
     // Returns a view of all mappings that have the given column key.
     std::unordered_map<R, V> column;
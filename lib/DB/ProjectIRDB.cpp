@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 
 #include <llvm/Analysis/AliasAnalysis.h>
 #include <llvm/Analysis/BasicAliasAnalysis.h>
@@ -33,6 +34,7 @@
 #include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
 #include <phasar/PhasarLLVM/Passes/GeneralStatisticsPass.h>
 #include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/Utils/CacheRegistry.h>
 #include <phasar/Utils/EnumFlags.h>
 #include <phasar/Utils/IO.h>
 #include <phasar/Utils/LLVMShorthands.h>
@@ -101,6 +103,10 @@ ProjectIRDB::ProjectIRDB(const std::vector<std::string> &IRFiles,
 }
 
 ProjectIRDB::~ProjectIRDB() {
+  // drop the caches that have been shared for the modules
+  for (auto M : getAllModules()) {
+    CacheRegistry::getInstance().release(M);
+  }
   // if the IRDB doesn't own the given pointers, they have to be released before
   // destruction
   if (Options & IRDBOptions::OWNSNOT) {
@@ -446,7 +452,7 @@ void ProjectIRDB::exportPATBCJSON() {
   std::cout << "ProjectIRDB::exportPATBCJSON\n";
 }
 
-std::string ProjectIRDB::valueToPersistedString(const llvm::Value *V) {
+std::string ProjectIRDB::valueToPersistedString(const llvm::Value *V) const {
   if (isLLVMZeroValue(V)) {
     return LLVMZeroValueInternalName;
   } else if (const llvm::Instruction *I =
@@ -456,80 +462,80 @@ std::string ProjectIRDB::valueToPersistedString(const llvm::Value *V) {
     return A->getParent()->getName().str() + ".f" + to_string(A->getArgNo());
   } else if (const llvm::GlobalValue *G =
                  llvm::dyn_cast<llvm::GlobalValue>(V)) {
-    std::cout << "special case: WE ARE AN GLOBAL VARIABLE\n";
-    std::cout << "all user:\n";
-    for (auto User : V->users()) {
-      if (const llvm::Instruction *I =
-              llvm::dyn_cast<llvm::Instruction>(User)) {
-        std::cout << I->getFunction()->getName().str() << "\n";
-      }
-    }
     return G->getName().str();
-  } else if (llvm::isa<llvm::Value>(V)) {
-    // In this case we should have an operand of an instruction which can be
-    // identified by the instruction id and the operand index.
-    std::cout << "special case: WE ARE AN OPERAND\n";
-    // We should only have one user in this special case
-    for (auto User : V->users()) {
-      if (const llvm::Instruction *I =
-              llvm::dyn_cast<llvm::Instruction>(User)) {
-        for (unsigned idx = 0; idx < I->getNumOperands(); ++idx) {
-          if (I->getOperand(idx) == V) {
-            return I->getFunction()->getName().str() + "." + getMetaDataID(I) +
-                   ".o." + to_string(idx);
-          }
+  }
+  // In this case we should have an operand of an instruction which can be
+  // identified by the instruction id and the operand index.
+  for (auto User : V->users()) {
+    if (const llvm::Instruction *I = llvm::dyn_cast<llvm::Instruction>(User)) {
+      for (unsigned idx = 0; idx < I->getNumOperands(); ++idx) {
+        if (I->getOperand(idx) == V) {
+          return valueToPersistedString(I) + ".o." + to_string(idx);
         }
       }
     }
-    UNRECOVERABLE_CXX_ERROR_UNCOND("llvm::Value is of unexpected type.");
-    return "";
-  } else {
-    UNRECOVERABLE_CXX_ERROR_UNCOND("llvm::Value is of unexpected type.");
-    return "";
   }
-}
-
-const llvm::Value *ProjectIRDB::persistedStringToValue(const std::string &S) {
-  if (S == LLVMZeroValueInternalName ||
-      S.find(LLVMZeroValueInternalName) != std::string::npos) {
+  throw runtime_error("llvm::Value cannot be persisted: " + llvmIRToString(V));
+}
+
+const llvm::Value *
+ProjectIRDB::persistedStringToValue(const std::string &S) const {
+  auto isNumber = [](const std::string &Str) {
+    return !Str.empty() && Str.find_first_not_of("0123456789") == Str.npos;
+  };
+  auto findFunction = [this](const std::string &Name) -> llvm::Function * {
+    for (const auto &entry : modules) {
+      if (llvm::Function *F = entry.second->getFunction(Name)) {
+        return F;
+      }
+    }
+    return nullptr;
+  };
+  if (S.find(LLVMZeroValueInternalName) != std::string::npos) {
     return LLVMZeroValue::getInstance();
-  } else if (S.find(".") == std::string::npos) {
-    return getGlobalVariable(S);
-  } else if (S.find(".f") != std::string::npos) {
-    unsigned argno = stoi(S.substr(S.find(".f") + 2, S.size()));
-    return getNthFunctionArgument(getFunction(S.substr(0, S.find(".f"))),
-                                  argno);
-  } else if (S.find(".o.") != std::string::npos) {
-    unsigned i = S.find(".");
-    unsigned j = S.find(".o.");
-    unsigned instID = stoi(S.substr(i + 1, j));
-    // std::cout << "FOUND instID: " << instID << "\n";
-    unsigned opIdx = stoi(S.substr(j + 3, S.size()));
-    // std::cout << "FOUND opIdx: " << to_string(opIdx) << "\n";
-    llvm::Function *F = getFunction(S.substr(0, S.find(".")));
-    for (auto &BB : *F) {
-      for (auto &I : BB) {
-        if (getMetaDataID(&I) == to_string(instID)) {
-          return I.getOperand(opIdx);
-        }
+  }
+  // check for globals first, since their names may contain dots as well
+  auto Global = globals.find(S);
+  if (Global != globals.end()) {
+    return modules.at(Global->second)->getGlobalVariable(S, true);
+  }
+  if (llvm::Function *F = findFunction(S)) {
+    return F;
+  }
+  size_t OperandSep = S.rfind(".o.");
+  if (OperandSep != std::string::npos &&
+      isNumber(S.substr(OperandSep + 3))) {
+    const llvm::Value *V = persistedStringToValue(S.substr(0, OperandSep));
+    unsigned opIdx = stoul(S.substr(OperandSep + 3));
+    if (const llvm::Instruction *I = llvm::dyn_cast<llvm::Instruction>(V)) {
+      if (opIdx < I->getNumOperands()) {
+        return I->getOperand(opIdx);
       }
     }
-    UNRECOVERABLE_CXX_ERROR_UNCOND("Operand not found.");
-  } else if (S.find(".") != std::string::npos) {
-    llvm::Function *F = getFunction(S.substr(0, S.find(".")));
-    for (auto &BB : *F) {
-      for (auto &I : BB) {
-        if (getMetaDataID(&I) == S.substr(S.find(".") + 1, S.size())) {
-          return &I;
+    throw runtime_error("Operand not found: " + S);
+  }
+  size_t Sep = S.rfind('.');
+  if (Sep != std::string::npos) {
+    std::string FName = S.substr(0, Sep);
+    std::string Id = S.substr(Sep + 1);
+    if (Id.size() > 1 && Id[0] == 'f' && isNumber(Id.substr(1))) {
+      if (llvm::Function *F = findFunction(FName)) {
+        if (auto Arg = getNthFunctionArgument(F, stoul(Id.substr(1)))) {
+          return Arg;
         }
       }
+      throw runtime_error("Formal parameter not found: " + S);
+    }
+    if (isNumber(Id)) {
+      auto Search = instructions.find(stoul(Id));
+      if (Search != instructions.end() &&
+          Search->second->getFunction()->getName() == FName) {
+        return Search->second;
+      }
+      throw runtime_error("llvm::Instruction not found: " + S);
     }
-    UNRECOVERABLE_CXX_ERROR_UNCOND("llvm::Instruction not found.");
-  } else {
-    UNRECOVERABLE_CXX_ERROR_UNCOND(
-        "string cannot be translated into llvm::Value.");
   }
-  return nullptr;
+  throw runtime_error("string cannot be translated into llvm::Value: " + S);
 }
 
 void ProjectIRDB::insertPointsToGraph(const std::string &FunctionName,
@@ -36,6 +36,7 @@
 #include <phasar/PhasarLLVM/ControlFlow/Resolver/RTAResolver.h>
 #include <phasar/PhasarLLVM/ControlFlow/Resolver/Resolver.h>
 
+#include <phasar/Utils/CacheRegistry.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
 #include <phasar/Utils/Macros.h>
@@ -165,6 +166,12 @@ LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Call graph has been constructed");
 }
 
+LLVMBasedICFG::~LLVMBasedICFG() {
+  // caches that solvers shared for this ICFG must not be handed out to an
+  // ICFG that is later constructed at the same address
+  CacheRegistry::getInstance().release(this);
+}
+
 void LLVMBasedICFG::constructionWalker(const llvm::Function *F,
                                        Resolver *resolver) {
   PAMM_GET_INSTANCE;
@@ -7,6 +7,8 @@
  *     Philipp Schubert and others
  *****************************************************************************/
 
+#include <algorithm>
+
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Value.h>
 
@@ -22,12 +24,13 @@ AutoKillTMPs::AutoKillTMPs(
     const llvm::Instruction *in)
     : delegate(ff), inst(in) {}
 
-std::set<const llvm::Value *>
+FFSet<const llvm::Value *>
 AutoKillTMPs::computeTargets(const llvm::Value *source) {
-  std::set<const llvm::Value *> result = delegate->computeTargets(source);
+  FFSet<const llvm::Value *> result = delegate->computeTargets(source);
   for (const llvm::Use &u : inst->operands()) {
     if (llvm::isa<llvm::LoadInst>(u)) {
-      result.erase(u);
+      result.erase(std::remove(result.begin(), result.end(), u.get()),
+                   result.end());
     }
   }
   return result;
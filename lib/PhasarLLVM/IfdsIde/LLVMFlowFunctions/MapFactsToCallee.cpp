@@ -7,12 +7,17 @@
  *     Philipp Schubert and others
  *****************************************************************************/
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <llvm/IR/CallSite.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Value.h>
 
 #include <phasar/PhasarLLVM/IfdsIde/LLVMFlowFunctions/MapFactsToCallee.h>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
+#include <phasar/Utils/CacheRegistry.h>
 
 #include <phasar/Utils/LLVMShorthands.h>
 
@@ -21,6 +26,38 @@ using namespace psr;
 
 namespace psr {
 
+namespace {
+
+// The allocations of %struct.__va_list_tag in the variadic functions of a
+// module
+struct VaListAllocations {
+  mutex Mtx;
+  unordered_map<const llvm::Function *, vector<const llvm::Value *>> Allocs;
+};
+
+// Collects the allocations of %struct.__va_list_tag in F, i.e.
+//   alloca [1 x %struct.__va_list_tag], align 16
+vector<const llvm::Value *> findVaListAllocs(const llvm::Function *F) {
+  vector<const llvm::Value *> Allocs;
+  for (auto &BB : *F) {
+    for (auto &I : BB) {
+      if (auto Alloc = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
+        if (Alloc->getAllocatedType()->isArrayTy() &&
+            Alloc->getAllocatedType()->getArrayNumElements() > 0 &&
+            Alloc->getAllocatedType()->getArrayElementType()->isStructTy() &&
+            Alloc->getAllocatedType()
+                    ->getArrayElementType()
+                    ->getStructName() == "struct.__va_list_tag") {
+          Allocs.push_back(Alloc);
+        }
+      }
+    }
+  }
+  return Allocs;
+}
+
+} // namespace
+
 MapFactsToCallee::MapFactsToCallee(
     const llvm::ImmutableCallSite &callSite, const llvm::Function *destMthd,
     function<bool(const llvm::Value *)> predicate)
@@ -33,57 +70,66 @@ MapFactsToCallee::MapFactsToCallee(
   for (unsigned idx = 0; idx < destMthd->arg_size(); ++idx) {
     formals.push_back(getNthFunctionArgument(destMthd, idx));
   }
+  // Find the allocated %struct.__va_list_tag's once, rather than on each
+  // application of the flow function. They only depend on the IR, hence they
+  // are shared by all call flow functions of the module.
+  if (destMthd->isVarArg() && !destMthd->isDeclaration()) {
+    auto Cache = CacheRegistry::getInstance().getOrCreate<VaListAllocations>(
+        destMthd->getParent(), "MapFactsToCallee",
+        [] { return make_shared<VaListAllocations>(); });
+    lock_guard<mutex> Lock(Cache->Mtx);
+    auto Search = Cache->Allocs.find(destMthd);
+    if (Search == Cache->Allocs.end()) {
+      Search =
+          Cache->Allocs.insert({destMthd, findVaListAllocs(destMthd)}).first;
+    }
+    vaListAllocs = Search->second;
+  }
 }
 
-set<const llvm::Value *>
+FFSet<const llvm::Value *>
 MapFactsToCallee::computeTargets(const llvm::Value *source) {
   if (!isLLVMZeroValue(source)) {
-    set<const llvm::Value *> res;
-    // Handle C-style varargs functions
-    if (destMthd->isVarArg()) {
-      // Map actual parameter into corresponding formal parameter.
-      for (unsigned idx = 0; idx < actuals.size(); ++idx) {
-        if (source == actuals[idx] && predicate(actuals[idx])) {
-          if (idx >= destMthd->arg_size() && !destMthd->isDeclaration()) {
-            // Over-approximate by trying to add the
-            //   alloca [1 x %struct.__va_list_tag], align 16
-            // to the results
-            // find the allocated %struct.__va_list_tag and generate it
-            for (auto &BB : *destMthd) {
-              for (auto &I : BB) {
-                if (auto Alloc = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
-                  if (Alloc->getAllocatedType()->isArrayTy() &&
-                      Alloc->getAllocatedType()->getArrayNumElements() > 0 &&
-                      Alloc->getAllocatedType()
-                          ->getArrayElementType()
-                          ->isStructTy() &&
-                      Alloc->getAllocatedType()
-                              ->getArrayElementType()
-                              ->getStructName() == "struct.__va_list_tag") {
-                    res.insert(Alloc);
-                  }
-                }
-              }
-            }
-          } else {
-            res.insert(formals[idx]); // corresponding formal
-          }
-        }
-      }
-      return res;
-    } else {
-      // Handle ordinary case
-      // Map actual parameter into corresponding formal parameter.
-      for (unsigned idx = 0; idx < actuals.size(); ++idx) {
-        if (source == actuals[idx] && predicate(actuals[idx])) {
-          res.insert(formals[idx]); // corresponding formal
+    FFSet<const llvm::Value *> res;
+    // Map actual parameter into corresponding formal parameter.
+    for (unsigned idx = 0; idx < actuals.size(); ++idx) {
+      if (source == actuals[idx] && predicate(actuals[idx])) {
+        if (destMthd->isVarArg() && idx >= destMthd->arg_size()) {
+          // Handle C-style varargs functions: over-approximate by generating
+          // the allocated %struct.__va_list_tag's
+          res.insert(res.end(), vaListAllocs.begin(), vaListAllocs.end());
+        } else {
+          res.push_back(formals[idx]); // corresponding formal
         }
       }
-      return res;
     }
+    return res;
   } else {
     return {source};
   }
 }
 
+void MapFactsToCallee::computeTargetsBatch(
+    const vector<const llvm::Value *> &Sources,
+    TargetBuffer<const llvm::Value *> &Targets) {
+  Targets.reserve(Sources.size(), Sources.size());
+  for (const llvm::Value *Source : Sources) {
+    if (isLLVMZeroValue(Source)) {
+      Targets.add(Source);
+      Targets.endSource();
+      continue;
+    }
+    for (unsigned idx = 0; idx < actuals.size(); ++idx) {
+      if (Source == actuals[idx] && predicate(actuals[idx])) {
+        if (destMthd->isVarArg() && idx >= destMthd->arg_size()) {
+          Targets.add(vaListAllocs.begin(), vaListAllocs.end());
+        } else {
+          Targets.add(formals[idx]);
+        }
+      }
+    }
+    Targets.endSource();
+  }
+}
+
 } // namespace psr
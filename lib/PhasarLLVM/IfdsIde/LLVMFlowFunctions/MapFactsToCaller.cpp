@@ -38,50 +38,47 @@ MapFactsToCaller::MapFactsToCaller(
   for (unsigned idx = 0; idx < calleeMthd->arg_size(); ++idx) {
     formals.push_back(getNthFunctionArgument(calleeMthd, idx));
   }
+  // Find the allocation of %struct.__va_list_tag once, rather than on each
+  // application of the flow function
+  if (calleeMthd->isVarArg() && !calleeMthd->isDeclaration()) {
+    for (auto &BB : *calleeMthd) {
+      for (auto &I : BB) {
+        if (auto Alloc = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
+          if (Alloc->getAllocatedType()->isArrayTy() &&
+              Alloc->getAllocatedType()->getArrayNumElements() > 0 &&
+              Alloc->getAllocatedType()->getArrayElementType()->isStructTy() &&
+              Alloc->getAllocatedType()
+                      ->getArrayElementType()
+                      ->getStructName() == "struct.__va_list_tag") {
+            vaListAlloc = Alloc;
+          }
+        }
+      }
+    }
+  }
 }
 
-set<const llvm::Value *>
+FFSet<const llvm::Value *>
 MapFactsToCaller::computeTargets(const llvm::Value *source) {
   if (!isLLVMZeroValue(source)) {
-    set<const llvm::Value *> res;
+    FFSet<const llvm::Value *> res;
     // Handle C-style varargs functions
-    if (calleeMthd->isVarArg() && !calleeMthd->isDeclaration()) {
-      const llvm::Instruction *AllocVarArg;
-      // Find the allocation of %struct.__va_list_tag
-      for (auto &BB : *calleeMthd) {
-        for (auto &I : BB) {
-          if (auto Alloc = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
-            if (Alloc->getAllocatedType()->isArrayTy() &&
-                Alloc->getAllocatedType()->getArrayNumElements() > 0 &&
-                Alloc->getAllocatedType()
-                    ->getArrayElementType()
-                    ->isStructTy() &&
-                Alloc->getAllocatedType()
-                        ->getArrayElementType()
-                        ->getStructName() == "struct.__va_list_tag") {
-              AllocVarArg = Alloc;
-              // TODO break out this nested loop earlier (without goto ;-)
-            }
-          }
-        }
-      }
-      // Generate the varargs things by using an over-approximation
-      if (source == AllocVarArg) {
-        for (unsigned idx = formals.size(); idx < actuals.size(); ++idx) {
-          res.insert(actuals[idx]);
-        }
+    // Generate the varargs things by using an over-approximation
+    if (vaListAlloc && source == vaListAlloc) {
+      for (unsigned idx = formals.size(); idx < actuals.size(); ++idx) {
+        res.push_back(actuals[idx]);
       }
     }
     // Handle ordinary case
     // Map formal parameter into corresponding actual parameter.
     for (unsigned idx = 0; idx < formals.size(); ++idx) {
       if (source == formals[idx] && paramPredicate(formals[idx])) {
-        res.insert(actuals[idx]); // corresponding actual
+        res.push_back(actuals[idx]); // corresponding actual
       }
     }
     // Collect return value facts
     if (source == exitStmt->getReturnValue() && returnPredicate(calleeMthd)) {
-      res.insert(callSite.getInstruction());
+      res.push_back(callSite.getInstruction());
     }
     return res;
   } else {
@@ -89,4 +86,32 @@ MapFactsToCaller::computeTargets(const llvm::Value *source) {
   }
 }
 
+void MapFactsToCaller::computeTargetsBatch(
+    const vector<const llvm::Value *> &Sources,
+    TargetBuffer<const llvm::Value *> &Targets) {
+  const llvm::Value *RetVal = exitStmt->getReturnValue();
+  bool MapsRetVal = RetVal && returnPredicate(calleeMthd);
+  Targets.reserve(Sources.size(), Sources.size());
+  for (const llvm::Value *Source : Sources) {
+    if (isLLVMZeroValue(Source)) {
+      Targets.add(Source);
+      Targets.endSource();
+      continue;
+    }
+    if (vaListAlloc && Source == vaListAlloc &&
+        actuals.size() > formals.size()) {
+      Targets.add(actuals.begin() + formals.size(), actuals.end());
+    }
+    for (unsigned idx = 0; idx < formals.size(); ++idx) {
+      if (Source == formals[idx] && paramPredicate(formals[idx])) {
+        Targets.add(actuals[idx]);
+      }
+    }
+    if (MapsRetVal && Source == RetVal) {
+      Targets.add(callSite.getInstruction());
+    }
+    Targets.endSource();
+  }
+}
+
 } // namespace psr
@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 // #include <functional>
+#include <cstdint>
 #include <limits>
 #include <utility>
 
@@ -38,10 +39,24 @@
 using namespace std;
 using namespace psr;
 
+namespace {
+
+// The arithmetic of the linear edge functions wraps around like the
+// integers of the analyzed program
+int64_t addWrapped(int64_t lhs, int64_t rhs) {
+  return static_cast<int64_t>(static_cast<uint64_t>(lhs) +
+                              static_cast<uint64_t>(rhs));
+}
+
+int64_t mulWrapped(int64_t lhs, int64_t rhs) {
+  return static_cast<int64_t>(static_cast<uint64_t>(lhs) *
+                              static_cast<uint64_t>(rhs));
+}
+
+} // namespace
+
 namespace psr {
 // Initialize debug counter for edge functions
-unsigned IDELinearConstantAnalysis::CurrGenConstant_Id = 0;
-unsigned IDELinearConstantAnalysis::CurrLCAID_Id = 0;
 unsigned IDELinearConstantAnalysis::CurrBinary_Id = 0;
 
 const IDELinearConstantAnalysis::v_t IDELinearConstantAnalysis::TOP =
@@ -56,11 +71,11 @@ IDELinearConstantAnalysis::IDELinearConstantAnalysis(
     : LLVMDefaultIDETabulationProblem(icfg, th, irdb),
       EntryPoints(EntryPoints) {
   LLVMDefaultIDETabulationProblem::zerovalue = createZeroValue();
+  // the edge functions of this analysis are pure and can be memoized
+  this->solver_config.edgeFunctionMemoSize = 1 << 16;
 }
 
 IDELinearConstantAnalysis::~IDELinearConstantAnalysis() {
-  IDELinearConstantAnalysis::CurrGenConstant_Id = 0;
-  IDELinearConstantAnalysis::CurrLCAID_Id = 0;
   IDELinearConstantAnalysis::CurrBinary_Id = 0;
 }
 
@@ -84,7 +99,7 @@ IDELinearConstantAnalysis::getNormalFlowFunction(
         LCAFF(IDELinearConstantAnalysis::d_t PointerOperand,
               IDELinearConstantAnalysis::d_t ZeroValue)
             : PointerOp(PointerOperand), ZeroValue(ZeroValue) {}
-        set<IDELinearConstantAnalysis::d_t>
+        FFSet<IDELinearConstantAnalysis::d_t>
         computeTargets(IDELinearConstantAnalysis::d_t source) override {
           if (source == PointerOp) {
             return {};
@@ -104,7 +119,7 @@ IDELinearConstantAnalysis::getNormalFlowFunction(
         LCAFF(IDELinearConstantAnalysis::d_t PointerOperand,
               IDELinearConstantAnalysis::d_t ValueOperand)
             : PointerOp(PointerOperand), ValueOp(ValueOperand) {}
-        set<IDELinearConstantAnalysis::d_t>
+        FFSet<IDELinearConstantAnalysis::d_t>
         computeTargets(IDELinearConstantAnalysis::d_t source) override {
           if (source == PointerOp) {
             return {};
@@ -134,11 +149,11 @@ IDELinearConstantAnalysis::getNormalFlowFunction(
     auto rop = curr->getOperand(1);
     return make_shared<GenIf<IDELinearConstantAnalysis::d_t>>(
         curr, zeroValue(),
-        [this, lop, rop](IDELinearConstantAnalysis::d_t source) {
-          return (source != zerovalue &&
+        [Zero = zerovalue, lop, rop](IDELinearConstantAnalysis::d_t source) {
+          return (source != Zero &&
                   ((lop == source && llvm::isa<llvm::ConstantInt>(rop)) ||
                    (rop == source && llvm::isa<llvm::ConstantInt>(lop)))) ||
-                 (source == zerovalue && llvm::isa<llvm::ConstantInt>(lop) &&
+                 (source == Zero && llvm::isa<llvm::ConstantInt>(lop) &&
                   llvm::isa<llvm::ConstantInt>(rop));
         });
   }
@@ -172,9 +187,9 @@ IDELinearConstantAnalysis::getCallFlowFunction(
           formals.push_back(getNthFunctionArgument(destMthd, idx));
         }
       }
-      set<IDELinearConstantAnalysis::d_t>
+      FFSet<IDELinearConstantAnalysis::d_t>
       computeTargets(IDELinearConstantAnalysis::d_t source) override {
-        set<IDELinearConstantAnalysis::d_t> res;
+        FFSet<IDELinearConstantAnalysis::d_t> res;
         for (unsigned idx = 0; idx < actuals.size(); ++idx) {
           if (source == actuals[idx]) {
             // Check for C-style varargs: idx >= destMthd->arg_size()
@@ -194,21 +209,21 @@ IDELinearConstantAnalysis::getCallFlowFunction(
                         Alloc->getAllocatedType()
                                 ->getArrayElementType()
                                 ->getStructName() == "struct.__va_list_tag") {
-                      res.insert(Alloc);
+                      res.push_back(Alloc);
                     }
                   }
                 }
               }
             } else {
               // Ordinary case: Just perform mapping
-              res.insert(formals[idx]); // corresponding formal
+              res.push_back(formals[idx]); // corresponding formal
             }
           }
           // Special case: Check if function is called with integer literals as
           // parameter (in case of varargs ignore)
           if (isLLVMZeroValue(source) && idx < destMthd->arg_size() &&
               llvm::isa<llvm::ConstantInt>(actuals[idx])) {
-            res.insert(formals[idx]); // corresponding formal
+            res.push_back(formals[idx]); // corresponding formal
           }
         }
         return res;
@@ -240,17 +255,17 @@ IDELinearConstantAnalysis::getRetFlowFunction(
       LCAFF(IDELinearConstantAnalysis::n_t cs,
             IDELinearConstantAnalysis::d_t retVal)
           : callSite(cs), ReturnValue(retVal) {}
-      set<IDELinearConstantAnalysis::d_t>
+      FFSet<IDELinearConstantAnalysis::d_t>
       computeTargets(IDELinearConstantAnalysis::d_t source) override {
-        set<IDELinearConstantAnalysis::d_t> res;
+        FFSet<IDELinearConstantAnalysis::d_t> res;
         // Collect return value fact
         if (source == ReturnValue) {
-          res.insert(callSite);
+          res.push_back(callSite);
         }
         // Return value is integer literal
         if (isLLVMZeroValue(source) &&
             llvm::isa<llvm::ConstantInt>(ReturnValue)) {
-          res.insert(callSite);
+          res.push_back(callSite);
         }
         return res;
       }
@@ -283,6 +298,12 @@ IDELinearConstantAnalysis::getSummaryFlowFunction(
   return nullptr;
 }
 
+string IDELinearConstantAnalysis::getCacheKey() const {
+  // the flow and edge functions only depend on the IR, the entry points only
+  // determine the seeds
+  return "IDELinearConstantAnalysis";
+}
+
 map<IDELinearConstantAnalysis::n_t, set<IDELinearConstantAnalysis::d_t>>
 IDELinearConstantAnalysis::initialSeeds() {
   // Check commandline arguments, e.g. argc, and generate all integer
@@ -361,14 +382,14 @@ IDELinearConstantAnalysis::getNormalEdgeFunction(
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
         auto CI = llvm::dyn_cast<llvm::ConstantInt>(valueOperand);
         auto IntConst = CI->getSExtValue();
-        return make_shared<IDELinearConstantAnalysis::GenConstant>(IntConst);
+        return LinearEdgeFunction::create(0, IntConst);
       }
       // Case II: Storing an integer typed value.
       if (currNode != succNode && valueOperand->getType()->isIntegerTy()) {
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Case: Storing an integer typed value.");
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-        return make_shared<IDELinearConstantAnalysis::LCAIdentity>();
+        return EdgeIdentity<IDELinearConstantAnalysis::v_t>::getInstance();
       }
     }
   }
@@ -379,7 +400,7 @@ IDELinearConstantAnalysis::getNormalEdgeFunction(
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "Case: Loading an integer typed value.");
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-      return make_shared<IDELinearConstantAnalysis::LCAIdentity>();
+      return EdgeIdentity<IDELinearConstantAnalysis::v_t>::getInstance();
     }
   }
   // Check for binary operations add, sub, mul, udiv/sdiv and urem/srem
@@ -389,6 +410,33 @@ IDELinearConstantAnalysis::getNormalEdgeFunction(
     unsigned OP = curr->getOpcode();
     auto lop = curr->getOperand(0);
     auto rop = curr->getOperand(1);
+    auto lic = llvm::dyn_cast<llvm::ConstantInt>(lop);
+    auto ric = llvm::dyn_cast<llvm::ConstantInt>(rop);
+    // Operations on two constants are folded
+    if (isZeroValue(currNode) && lic && ric) {
+      return LinearEdgeFunction::create(
+          0, IDELinearConstantAnalysis::executeBinOperation(
+                 OP, lic->getSExtValue(), ric->getSExtValue()));
+    }
+    // Additions, subtractions and multiplications of a value and a constant
+    // are linear
+    if ((lop == currNode && ric) || (rop == currNode && lic)) {
+      IDELinearConstantAnalysis::v_t C =
+          (lop == currNode ? ric : lic)->getSExtValue();
+      switch (OP) {
+      case llvm::Instruction::Add:
+        return LinearEdgeFunction::create(1, C);
+      case llvm::Instruction::Sub:
+        return lop == currNode
+                   ? LinearEdgeFunction::create(1, mulWrapped(-1, C))
+                   : LinearEdgeFunction::create(-1, C);
+      case llvm::Instruction::Mul:
+        return LinearEdgeFunction::create(C, 0);
+      default:
+        break;
+      }
+    }
+    // All other operations, i.e. divisions and remainders, are not linear
     struct LCAEF : EdgeFunction<IDELinearConstantAnalysis::v_t>,
                    enable_shared_from_this<LCAEF> {
       const unsigned EdgeFunctionID, Op;
@@ -409,6 +457,11 @@ IDELinearConstantAnalysis::getNormalEdgeFunction(
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Curr Node : " << llvmIRToString(currNode));
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+        // like the linear functions, keep the top and bottom values
+        if (source == IDELinearConstantAnalysis::TOP ||
+            source == IDELinearConstantAnalysis::BOTTOM) {
+          return source;
+        }
         if (lop == currNode && llvm::isa<llvm::ConstantInt>(rop)) {
           auto ric = llvm::dyn_cast<llvm::ConstantInt>(rop);
           return IDELinearConstantAnalysis::executeBinOperation(
@@ -437,9 +490,6 @@ IDELinearConstantAnalysis::getNormalEdgeFunction(
                     secondFunction.get())) {
           return this->shared_from_this();
         }
-        if (auto *LSVI = dynamic_cast<LCAIdentity *>(secondFunction.get())) {
-          return this->shared_from_this();
-        }
         return make_shared<IDELinearConstantAnalysis::LCAEdgeFunctionComposer>(
             this->shared_from_this(), secondFunction);
       }
@@ -504,7 +554,7 @@ IDELinearConstantAnalysis::getCallEdgeFunction(
       auto actual = CS.getArgOperand(getFunctionArgumentNr(A));
       if (auto CI = llvm::dyn_cast<llvm::ConstantInt>(actual)) {
         auto IntConst = CI->getSExtValue();
-        return make_shared<IDELinearConstantAnalysis::GenConstant>(IntConst);
+        return LinearEdgeFunction::create(0, IntConst);
       }
     }
   }
@@ -546,7 +596,7 @@ IDELinearConstantAnalysis::getReturnEdgeFunction(
     auto ReturnValue = Return->getReturnValue();
     if (auto CI = llvm::dyn_cast<llvm::ConstantInt>(ReturnValue)) {
       auto IntConst = CI->getSExtValue();
-      return make_shared<IDELinearConstantAnalysis::GenConstant>(IntConst);
+      return LinearEdgeFunction::create(0, IntConst);
     }
   }
   return EdgeIdentity<IDELinearConstantAnalysis::v_t>::getInstance();
@@ -611,9 +661,6 @@ IDELinearConstantAnalysis::LCAEdgeFunctionComposer::composeWith(
           secondFunction.get())) {
     return this->shared_from_this();
   }
-  if (auto *LSVI = dynamic_cast<LCAIdentity *>(secondFunction.get())) {
-    return this->shared_from_this();
-  }
   return F->composeWith(G->composeWith(secondFunction));
 }
 
@@ -632,73 +679,69 @@ IDELinearConstantAnalysis::LCAEdgeFunctionComposer::joinWith(
       IDELinearConstantAnalysis::BOTTOM);
 }
 
-IDELinearConstantAnalysis::GenConstant::GenConstant(
-    IDELinearConstantAnalysis::v_t IntConst)
-    : GenConstant_Id(++IDELinearConstantAnalysis::CurrGenConstant_Id),
-      IntConst(IntConst) {}
+IDELinearConstantAnalysis::LinearEdgeFunction::LinearEdgeFunction(
+    IDELinearConstantAnalysis::v_t Factor,
+    IDELinearConstantAnalysis::v_t Summand)
+    : Factor(Factor), Summand(Summand) {}
+
+shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>>
+IDELinearConstantAnalysis::LinearEdgeFunction::create(
+    IDELinearConstantAnalysis::v_t Factor,
+    IDELinearConstantAnalysis::v_t Summand) {
+  if (Factor == 1 && Summand == 0) {
+    return EdgeIdentity<IDELinearConstantAnalysis::v_t>::getInstance();
+  }
+  return make_shared<IDELinearConstantAnalysis::LinearEdgeFunction>(Factor,
+                                                                    Summand);
+}
 
 IDELinearConstantAnalysis::v_t
-IDELinearConstantAnalysis::GenConstant::computeTarget(
+IDELinearConstantAnalysis::LinearEdgeFunction::computeTarget(
     IDELinearConstantAnalysis::v_t source) {
-  return IntConst;
+  if (Factor == 0) {
+    return Summand;
+  }
+  if (source == IDELinearConstantAnalysis::TOP ||
+      source == IDELinearConstantAnalysis::BOTTOM) {
+    return source;
+  }
+  return addWrapped(mulWrapped(Factor, source), Summand);
 }
 
 shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>>
-IDELinearConstantAnalysis::GenConstant::composeWith(
+IDELinearConstantAnalysis::LinearEdgeFunction::composeWith(
     shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> secondFunction) {
   if (auto *EI = dynamic_cast<EdgeIdentity<IDELinearConstantAnalysis::v_t> *>(
           secondFunction.get())) {
     return this->shared_from_this();
   }
-  if (auto *LSVI = dynamic_cast<LCAIdentity *>(secondFunction.get())) {
-    return this->shared_from_this();
+  // all-top and all-bottom functions ignore their argument
+  if (dynamic_cast<AllTop<IDELinearConstantAnalysis::v_t> *>(
+          secondFunction.get()) ||
+      dynamic_cast<AllBottom<IDELinearConstantAnalysis::v_t> *>(
+          secondFunction.get())) {
+    return secondFunction;
   }
-  return make_shared<IDELinearConstantAnalysis::LCAEdgeFunctionComposer>(
-      this->shared_from_this(), secondFunction);
-}
-
-shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>>
-IDELinearConstantAnalysis::GenConstant::joinWith(
-    shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> otherFunction) {
-  if (otherFunction.get() == this ||
-      otherFunction->equal_to(this->shared_from_this())) {
-    return this->shared_from_this();
+  if (auto *L = dynamic_cast<IDELinearConstantAnalysis::LinearEdgeFunction *>(
+          secondFunction.get())) {
+    if (Factor == 0) {
+      return create(0, L->computeTarget(Summand));
+    }
+    // L(x) = L.Factor * (Factor * x + Summand) + L.Summand
+    return create(mulWrapped(L->Factor, Factor),
+                  addWrapped(mulWrapped(L->Factor, Summand), L->Summand));
   }
-  return make_shared<AllBottom<IDELinearConstantAnalysis::v_t>>(
-      IDELinearConstantAnalysis::BOTTOM);
-}
-
-bool IDELinearConstantAnalysis::GenConstant::equal_to(
-    shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> other) const {
-  if (auto *StC =
-          dynamic_cast<IDELinearConstantAnalysis::GenConstant *>(other.get())) {
-    return (StC->IntConst == this->IntConst);
+  // a constant can be folded into any other function
+  if (Factor == 0 && Summand != IDELinearConstantAnalysis::TOP &&
+      Summand != IDELinearConstantAnalysis::BOTTOM) {
+    return create(0, secondFunction->computeTarget(Summand));
   }
-  return this == other.get();
-}
-
-void IDELinearConstantAnalysis::GenConstant::print(ostream &OS,
-                                                   bool isForDebug) const {
-  OS << "GenConstant_" << GenConstant_Id;
-}
-
-IDELinearConstantAnalysis::LCAIdentity::LCAIdentity()
-    : LCAID_Id(++IDELinearConstantAnalysis::CurrLCAID_Id) {}
-
-IDELinearConstantAnalysis::v_t
-IDELinearConstantAnalysis::LCAIdentity::computeTarget(
-    IDELinearConstantAnalysis::v_t source) {
-  return source;
-}
-
-shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>>
-IDELinearConstantAnalysis::LCAIdentity::composeWith(
-    shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> secondFunction) {
-  return secondFunction;
+  return make_shared<IDELinearConstantAnalysis::LCAEdgeFunctionComposer>(
+      this->shared_from_this(), secondFunction);
 }
 
 shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>>
-IDELinearConstantAnalysis::LCAIdentity::joinWith(
+IDELinearConstantAnalysis::LinearEdgeFunction::joinWith(
     shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> otherFunction) {
   if (otherFunction.get() == this ||
       otherFunction->equal_to(this->shared_from_this())) {
@@ -712,14 +755,23 @@ IDELinearConstantAnalysis::LCAIdentity::joinWith(
       IDELinearConstantAnalysis::BOTTOM);
 }
 
-bool IDELinearConstantAnalysis::LCAIdentity::equal_to(
+bool IDELinearConstantAnalysis::LinearEdgeFunction::equal_to(
     shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> other) const {
-  return this == other.get();
+  if (auto *L = dynamic_cast<IDELinearConstantAnalysis::LinearEdgeFunction *>(
+          other.get())) {
+    return L->Factor == Factor && L->Summand == Summand;
+  }
+  return false;
+}
+
+size_t IDELinearConstantAnalysis::LinearEdgeFunction::hash() const {
+  return std::hash<IDELinearConstantAnalysis::v_t>()(Factor) * 31 +
+         std::hash<IDELinearConstantAnalysis::v_t>()(Summand);
 }
 
-void IDELinearConstantAnalysis::LCAIdentity::print(ostream &OS,
-                                                   bool isForDebug) const {
-  OS << "LCAIdentity_" << LCAID_Id;
+void IDELinearConstantAnalysis::LinearEdgeFunction::print(
+    ostream &OS, bool isForDebug) const {
+  OS << "Linear_" << Factor << "*x+" << Summand;
 }
 
 IDELinearConstantAnalysis::v_t IDELinearConstantAnalysis::executeBinOperation(
@@ -8,6 +8,8 @@
  *****************************************************************************/
 
 #include <algorithm>
+#include <cassert>
+#include <utility>
 
 #include <llvm/IR/CallSite.h>
 #include <llvm/IR/Function.h>
@@ -44,7 +46,7 @@ IDETypeStateAnalysis::IDETypeStateAnalysis(IDETypeStateAnalysis::i_t icfg,
                                            const ProjectIRDB &irdb,
                                            const TypeStateDescription &tsd,
                                            vector<string> EntryPoints)
-    : LLVMDefaultIDETabulationProblem(icfg, th, irdb), TSD(tsd),
+    : LLVMDefaultIDETabulationProblem(icfg, th, irdb), TSD(tsd), TSTable(tsd),
       EntryPoints(EntryPoints), TOP(TSD.top()), BOTTOM(TSD.bottom()) {
   DefaultIDETabulationProblem::zerovalue = createZeroValue();
 }
@@ -73,7 +75,7 @@ IDETypeStateAnalysis::getNormalFlowFunction(IDETypeStateAnalysis::n_t curr,
 
         TSFlowFunction(const llvm::LoadInst *L) : Load(L) {}
         ~TSFlowFunction() override = default;
-        set<IDETypeStateAnalysis::d_t>
+        FFSet<IDETypeStateAnalysis::d_t>
         computeTargets(IDETypeStateAnalysis::d_t source) override {
           if (source == Load) {
             return {};
@@ -103,7 +105,7 @@ IDETypeStateAnalysis::getNormalFlowFunction(IDETypeStateAnalysis::n_t curr,
                        std::set<IDETypeStateAnalysis::d_t> AA)
             : Store(S), AliasesAndAllocas(AA) {}
         ~TSFlowFunction() override = default;
-        set<IDETypeStateAnalysis::d_t>
+        FFSet<IDETypeStateAnalysis::d_t>
         computeTargets(IDETypeStateAnalysis::d_t source) override {
           // We kill all relevant loacal aliases and alloca's
           if (source != Store->getValueOperand() &&
@@ -114,7 +116,8 @@ IDETypeStateAnalysis::getNormalFlowFunction(IDETypeStateAnalysis::n_t curr,
           // value
           if (source == Store->getValueOperand()) {
             AliasesAndAllocas.insert(source);
-            return AliasesAndAllocas;
+            return FFSet<IDETypeStateAnalysis::d_t>(AliasesAndAllocas.begin(),
+                                                    AliasesAndAllocas.end());
           }
           return {source};
         }
@@ -140,8 +143,8 @@ IDETypeStateAnalysis::getCallFlowFunction(IDETypeStateAnalysis::n_t callStmt,
   // standard mapping.
   if (llvm::isa<llvm::CallInst>(callStmt) ||
       llvm::isa<llvm::InvokeInst>(callStmt)) {
-    return make_shared<MapFactsToCallee>(llvm::ImmutableCallSite(callStmt),
-                                         destMthd);
+    return makeFunction<MapFactsToCallee>(llvm::ImmutableCallSite(callStmt),
+                                          destMthd);
   }
   assert(false && "callStmt not a CallInst nor a InvokeInst");
 }
@@ -183,10 +186,10 @@ IDETypeStateAnalysis::getRetFlowFunction(IDETypeStateAnalysis::n_t callSite,
 
     ~TSFlowFunction() override = default;
 
-    set<IDETypeStateAnalysis::d_t>
+    FFSet<IDETypeStateAnalysis::d_t>
     computeTargets(IDETypeStateAnalysis::d_t source) override {
       if (!isLLVMZeroValue(source)) {
-        set<const llvm::Value *> res;
+        FFSet<IDETypeStateAnalysis::d_t> res;
         // Handle C-style varargs functions
         if (CalleeMthd->isVarArg() && !CalleeMthd->isDeclaration()) {
           const llvm::Instruction *AllocVarArg;
@@ -211,7 +214,7 @@ IDETypeStateAnalysis::getRetFlowFunction(IDETypeStateAnalysis::n_t callSite,
           // Generate the varargs things by using an over-approximation
           if (source == AllocVarArg) {
             for (unsigned idx = formals.size(); idx < actuals.size(); ++idx) {
-              res.insert(actuals[idx]);
+              res.push_back(actuals[idx]);
             }
           }
         }
@@ -219,12 +222,12 @@ IDETypeStateAnalysis::getRetFlowFunction(IDETypeStateAnalysis::n_t callSite,
         // Map formal parameter into corresponding actual parameter.
         for (unsigned idx = 0; idx < formals.size(); ++idx) {
           if (source == formals[idx]) {
-            res.insert(actuals[idx]); // corresponding actual
+            res.push_back(actuals[idx]); // corresponding actual
           }
         }
         // Collect the return value
         if (source == ExitStmt->getReturnValue()) {
-          res.insert(CallSite.getInstruction());
+          res.push_back(CallSite.getInstruction());
         }
         // Collect all relevant alloca's to map into caller context
         std::set<IDETypeStateAnalysis::d_t> RelAllocas;
@@ -232,7 +235,7 @@ IDETypeStateAnalysis::getRetFlowFunction(IDETypeStateAnalysis::n_t callSite,
           auto allocas = Analysis->getRelevantAllocas(fact);
           RelAllocas.insert(allocas.begin(), allocas.end());
         }
-        res.insert(RelAllocas.begin(), RelAllocas.end());
+        res.insert(res.end(), RelAllocas.begin(), RelAllocas.end());
         return res;
       } else {
         return {source};
@@ -262,7 +265,7 @@ IDETypeStateAnalysis::getCallToRetFlowFunction(
                        IDETypeStateAnalysis::d_t Z)
             : CallSite(CS), ZeroValue(Z) {}
         ~TSFlowFunction() override = default;
-        set<IDETypeStateAnalysis::d_t>
+        FFSet<IDETypeStateAnalysis::d_t>
         computeTargets(IDETypeStateAnalysis::d_t source) override {
           if (source == CallSite) {
             return {};
@@ -352,21 +355,7 @@ IDETypeStateAnalysis::getNormalEdgeFunction(
   if (auto Alloca = llvm::dyn_cast<llvm::AllocaInst>(curr)) {
     if (hasMatchingType(Alloca)) {
       if (currNode == zeroValue() && succNode == Alloca) {
-        struct TSAllocaEF : public TSEdgeFunction {
-          TSAllocaEF(const TypeStateDescription &tsd, const std::string &tok)
-              : TSEdgeFunction(tsd, tok) {}
-
-          IDETypeStateAnalysis::v_t
-          computeTarget(IDETypeStateAnalysis::v_t source) override {
-            CurrentState = TSD.uninit();
-            return CurrentState;
-          }
-
-          void print(std::ostream &OS, bool isForDebug = false) const override {
-            OS << "TSAllocaEF(" << TSD.stateToString(CurrentState) << ")";
-          }
-        };
-        return make_shared<TSAllocaEF>(TSD, "alloca instruction");
+        return TSEdgeFunction::createConstant(TSTable, TSD.uninit());
       }
     }
   }
@@ -459,21 +448,7 @@ IDETypeStateAnalysis::getCallToRetEdgeFunction(
     if (TSD.isFactoryFunction(demangledFname)) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Processing factory function");
       if (isZeroValue(callNode) && retSiteNode == CS.getInstruction()) {
-        struct TSFactoryEF : public TSEdgeFunction {
-          TSFactoryEF(const TypeStateDescription &tsd, const std::string &tok)
-              : TSEdgeFunction(tsd, tok) {}
-
-          IDETypeStateAnalysis::v_t
-          computeTarget(IDETypeStateAnalysis::v_t source) override {
-            CurrentState = TSD.start();
-            return CurrentState;
-          }
-
-          void print(std::ostream &OS, bool isForDebug = false) const override {
-            OS << "TSFactoryEF(" << TSD.stateToString(CurrentState) << ")";
-          }
-        };
-        return make_shared<TSFactoryEF>(TSD, demangledFname);
+        return TSEdgeFunction::createConstant(TSTable, TSD.start());
       }
     }
 
@@ -482,13 +457,15 @@ IDETypeStateAnalysis::getCallToRetEdgeFunction(
     if (TSD.isConsumingFunction(demangledFname)) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "Processing consuming function");
+      auto FId = TSTable.getFunctionId(demangledFname);
+      assert(FId && "consuming function is not part of the api");
       for (auto Idx : TSD.getConsumerParamIdx(demangledFname)) {
         std::set<IDETypeStateAnalysis::d_t> PointsToAndAllocas =
             getWMAliasesAndAllocas(CS.getArgument(Idx));
 
         if (callNode == retSiteNode &&
             PointsToAndAllocas.find(callNode) != PointsToAndAllocas.end()) {
-          return make_shared<TSEdgeFunction>(TSD, demangledFname);
+          return TSEdgeFunction::createTransition(TSTable, *FId);
         }
       }
     }
@@ -560,27 +537,70 @@ IDETypeStateAnalysis::TSEdgeFunctionComposer::joinWith(
   return make_shared<AllBottom<IDETypeStateAnalysis::v_t>>(botElement);
 }
 
+shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>>
+IDETypeStateAnalysis::TSEdgeFunction::create(
+    const TypeStateTransitionTable &Table, vector<StateIdx> Mapping) {
+  for (size_t S = 0; S < Mapping.size(); ++S) {
+    if (Mapping[S] != S) {
+      return make_shared<TSEdgeFunction>(Table, std::move(Mapping));
+    }
+  }
+  return EdgeIdentity<IDETypeStateAnalysis::v_t>::getInstance();
+}
+
+shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>>
+IDETypeStateAnalysis::TSEdgeFunction::createTransition(
+    const TypeStateTransitionTable &Table,
+    TypeStateTransitionTable::FunctionId F) {
+  vector<StateIdx> Mapping(Table.getNumStates());
+  for (size_t S = 0; S < Mapping.size(); ++S) {
+    Mapping[S] = Table.getNextState(F, S);
+  }
+  return create(Table, std::move(Mapping));
+}
+
+shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>>
+IDETypeStateAnalysis::TSEdgeFunction::createConstant(
+    const TypeStateTransitionTable &Table, IDETypeStateAnalysis::v_t S) {
+  return make_shared<TSEdgeFunction>(
+      Table, vector<StateIdx>(Table.getNumStates(), Table.getStateIdx(S)));
+}
+
 IDETypeStateAnalysis::v_t IDETypeStateAnalysis::TSEdgeFunction::computeTarget(
     IDETypeStateAnalysis::v_t source) {
   auto &lg = lg::get();
-  CurrentState = TSD.getNextState(Token, source);
+  auto Target = Table.getState(Mapping[Table.getStateIdx(source)]);
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                << "State machine transition: (" << Token << " , "
-                << TSD.stateToString(source) << ") -> "
-                << TSD.stateToString(CurrentState));
-  return CurrentState;
+                << "State machine transition: "
+                << Table.getDescription().stateToString(source) << " -> "
+                << Table.getDescription().stateToString(Target));
+  return Target;
 }
 
 std::shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>>
 IDETypeStateAnalysis::TSEdgeFunction::composeWith(
     std::shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>> secondFunction) {
+  if (auto *TSEF = dynamic_cast<TSEdgeFunction *>(secondFunction.get())) {
+    vector<StateIdx> Composed(Mapping.size());
+    for (size_t S = 0; S < Mapping.size(); ++S) {
+      Composed[S] = TSEF->Mapping[Mapping[S]];
+    }
+    return create(Table, std::move(Composed));
+  }
   if (auto *EI = dynamic_cast<EdgeIdentity<IDETypeStateAnalysis::v_t> *>(
           secondFunction.get())) {
     return this->shared_from_this();
   }
-  // TODO: Can we reduce the EF if composed with AllTop?
-  return make_shared<TSEdgeFunctionComposer>(this->shared_from_this(),
-                                             secondFunction, TSD.bottom());
+  // AllTop and AllBottom do not depend on their input
+  if (dynamic_cast<AllTop<IDETypeStateAnalysis::v_t> *>(
+          secondFunction.get()) ||
+      dynamic_cast<AllBottom<IDETypeStateAnalysis::v_t> *>(
+          secondFunction.get())) {
+    return secondFunction;
+  }
+  return make_shared<TSEdgeFunctionComposer>(
+      this->shared_from_this(), secondFunction,
+      Table.getState(TypeStateTransitionTable::BottomIdx));
 }
 
 std::shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>>
@@ -594,21 +614,55 @@ IDETypeStateAnalysis::TSEdgeFunction::joinWith(
           otherFunction.get())) {
     return this->shared_from_this();
   }
-  return make_shared<AllBottom<IDETypeStateAnalysis::v_t>>(TSD.bottom());
+  // join point-wise, the identity maps every state to itself
+  if (auto *TSEF = dynamic_cast<TSEdgeFunction *>(otherFunction.get())) {
+    vector<StateIdx> Joined(Mapping.size());
+    for (size_t S = 0; S < Mapping.size(); ++S) {
+      Joined[S] = Table.join(Mapping[S], TSEF->Mapping[S]);
+    }
+    return create(Table, std::move(Joined));
+  }
+  if (auto *EI = dynamic_cast<EdgeIdentity<IDETypeStateAnalysis::v_t> *>(
+          otherFunction.get())) {
+    vector<StateIdx> Joined(Mapping.size());
+    for (size_t S = 0; S < Mapping.size(); ++S) {
+      Joined[S] = Table.join(Mapping[S], S);
+    }
+    return create(Table, std::move(Joined));
+  }
+  return make_shared<AllBottom<IDETypeStateAnalysis::v_t>>(
+      Table.getState(TypeStateTransitionTable::BottomIdx));
 }
 
 bool IDETypeStateAnalysis::TSEdgeFunction::equal_to(
     std::shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>> other) const {
   if (auto *TSEF =
           dynamic_cast<IDETypeStateAnalysis::TSEdgeFunction *>(other.get())) {
-    return this->CurrentState == TSEF->CurrentState;
+    return &Table == &TSEF->Table && Mapping == TSEF->Mapping;
   }
   return this == other.get();
 }
 
+size_t IDETypeStateAnalysis::TSEdgeFunction::hash() const {
+  size_t H = 0;
+  for (auto S : Mapping) {
+    H = H * 31 + S;
+  }
+  return H;
+}
+
 void IDETypeStateAnalysis::TSEdgeFunction::print(ostream &OS,
                                                  bool isForDebug) const {
-  OS << "TSEdgeFunc(" << TSD.stateToString(CurrentState) << ")";
+  OS << "TSEdgeFunc(";
+  for (size_t S = TypeStateTransitionTable::BottomIdx + 1; S < Mapping.size();
+       ++S) {
+    if (S > TypeStateTransitionTable::BottomIdx + 1) {
+      OS << ", ";
+    }
+    OS << Table.getDescription().stateToString(Table.getState(S)) << " -> "
+       << Table.getDescription().stateToString(Table.getState(Mapping[S]));
+  }
+  OS << ")";
 }
 
 std::set<IDETypeStateAnalysis::d_t>
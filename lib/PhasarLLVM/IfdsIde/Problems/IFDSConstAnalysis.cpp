@@ -148,7 +148,7 @@ IFDSConstAnalysis::getCallFlowFunction(IFDSConstAnalysis::n_t callStmt,
                   << "Call statement: " << llvmIRToString(callStmt));
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "Destination method: " << destMthd->getName().str());
-    return make_shared<MapFactsToCallee>(
+    return makeFunction<MapFactsToCallee>(
         llvm::ImmutableCallSite(callStmt), destMthd,
         [](IFDSConstAnalysis::d_t actual) {
           return actual->getType()->isPointerTy();
@@ -180,7 +180,7 @@ IFDSConstAnalysis::getRetFlowFunction(IFDSConstAnalysis::n_t callSite,
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                 << "Callee exit statement: " << llvmIRToString(exitStmt));
   // Map formal parameter back to the actual parameter in the caller.
-  return make_shared<MapFactsToCaller>(
+  return makeFunction<MapFactsToCaller>(
       llvm::ImmutableCallSite(callSite), calleeMthd, exitStmt,
       [](IFDSConstAnalysis::d_t formal) {
         return formal->getType()->isPointerTy();
@@ -254,6 +254,11 @@ IFDSConstAnalysis::initialSeeds() {
   return SeedMap;
 }
 
+bool IFDSConstAnalysis::mayAffect(IFDSConstAnalysis::n_t n,
+                                  IFDSConstAnalysis::d_t d) {
+  return llvm::isa<llvm::StoreInst>(n);
+}
+
 IFDSConstAnalysis::d_t IFDSConstAnalysis::createZeroValue() {
   auto &lg = lg::get();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
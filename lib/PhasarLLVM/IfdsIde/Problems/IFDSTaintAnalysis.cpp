@@ -53,11 +53,10 @@ IFDSTaintAnalysis::getNormalFlowFunction(IFDSTaintAnalysis::n_t curr,
     struct TAFF : FlowFunction<IFDSTaintAnalysis::d_t> {
       const llvm::StoreInst *store;
       TAFF(const llvm::StoreInst *s) : store(s){};
-      set<IFDSTaintAnalysis::d_t>
+      FFSet<IFDSTaintAnalysis::d_t>
       computeTargets(IFDSTaintAnalysis::d_t source) override {
         if (store->getValueOperand() == source) {
-          return set<IFDSTaintAnalysis::d_t>{store->getPointerOperand(),
-                                             source};
+          return {store->getPointerOperand(), source};
         } else if (store->getValueOperand() != source &&
                    store->getPointerOperand() == source) {
           return {};
@@ -105,8 +104,8 @@ IFDSTaintAnalysis::getCallFlowFunction(IFDSTaintAnalysis::n_t callStmt,
   // Map the actual into the formal parameters
   if (llvm::isa<llvm::CallInst>(callStmt) ||
       llvm::isa<llvm::InvokeInst>(callStmt)) {
-    return make_shared<MapFactsToCallee>(llvm::ImmutableCallSite(callStmt),
-                                         destMthd);
+    return makeFunction<MapFactsToCallee>(llvm::ImmutableCallSite(callStmt),
+                                          destMthd);
   }
   // Pass everything else as identity
   return Identity<IFDSTaintAnalysis::d_t>::getInstance();
@@ -123,7 +122,7 @@ IFDSTaintAnalysis::getRetFlowFunction(IFDSTaintAnalysis::n_t callSite,
   // We must check if the return value and formal parameter are tainted, if so
   // we must taint all user's of the function call. We are only interested in
   // formal parameters of pointer/reference type.
-  return make_shared<MapFactsToCaller>(
+  return makeFunction<MapFactsToCaller>(
       llvm::ImmutableCallSite(callSite), calleeMthd, exitStmt,
       [](IFDSTaintAnalysis::d_t formal) {
         return formal->getType()->isPointerTy();
@@ -180,7 +179,7 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
              const IFDSTaintAnalysis *ta)
             : callSite(cs), calledMthd(calledMthd), Sink(s), Leaks(leaks),
               taintanalysis(ta) {}
-        set<IFDSTaintAnalysis::d_t>
+        FFSet<IFDSTaintAnalysis::d_t>
         computeTargets(IFDSTaintAnalysis::d_t source) override {
           // check if a tainted value flows into a sink
           // if so, add to Leaks and return id
@@ -249,6 +248,27 @@ IFDSTaintAnalysis::initialSeeds() {
   return SeedMap;
 }
 
+bool IFDSTaintAnalysis::shouldTerminate(IFDSTaintAnalysis::n_t n,
+                                        IFDSTaintAnalysis::d_t d) {
+  return MaxLeaks != 0 && Leaks.size() >= MaxLeaks;
+}
+
+bool IFDSTaintAnalysis::mayAffect(IFDSTaintAnalysis::n_t n,
+                                  IFDSTaintAnalysis::d_t d) {
+  // only stores, loads and address computations that use the fact are not
+  // the identity, see getNormalFlowFunction()
+  if (auto Store = llvm::dyn_cast<llvm::StoreInst>(n)) {
+    return Store->getValueOperand() == d || Store->getPointerOperand() == d;
+  }
+  if (auto Load = llvm::dyn_cast<llvm::LoadInst>(n)) {
+    return Load->getPointerOperand() == d;
+  }
+  if (auto GEP = llvm::dyn_cast<llvm::GetElementPtrInst>(n)) {
+    return GEP->getPointerOperand() == d;
+  }
+  return false;
+}
+
 IFDSTaintAnalysis::d_t IFDSTaintAnalysis::createZeroValue() {
   auto &lg = lg::get();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
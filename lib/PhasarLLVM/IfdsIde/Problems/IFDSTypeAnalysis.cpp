@@ -34,9 +34,9 @@ IFDSTypeAnalysis::getNormalFlowFunction(IFDSTypeAnalysis::n_t curr,
                                         IFDSTypeAnalysis::n_t succ) {
   cout << "type analysis getNormalFlowFunction()" << endl;
   struct TAFF : FlowFunction<IFDSTypeAnalysis::d_t> {
-    set<IFDSTypeAnalysis::d_t>
+    FFSet<IFDSTypeAnalysis::d_t>
     computeTargets(IFDSTypeAnalysis::d_t source) override {
-      return set<IFDSTypeAnalysis::d_t>{};
+      return {};
     }
   };
   return make_shared<TAFF>();
@@ -47,9 +47,9 @@ IFDSTypeAnalysis::getCallFlowFunction(IFDSTypeAnalysis::n_t callStmt,
                                       IFDSTypeAnalysis::m_t destMthd) {
   cout << "type analysis getCallFlowFunction()" << endl;
   struct TAFF : FlowFunction<IFDSTypeAnalysis::d_t> {
-    set<IFDSTypeAnalysis::d_t>
+    FFSet<IFDSTypeAnalysis::d_t>
     computeTargets(IFDSTypeAnalysis::d_t source) override {
-      return set<IFDSTypeAnalysis::d_t>{};
+      return {};
     }
   };
   return make_shared<TAFF>();
@@ -62,9 +62,9 @@ IFDSTypeAnalysis::getRetFlowFunction(IFDSTypeAnalysis::n_t callSite,
                                      IFDSTypeAnalysis::n_t retSite) {
   cout << "type analysis getRetFlowFunction()" << endl;
   struct TAFF : FlowFunction<IFDSTypeAnalysis::d_t> {
-    set<IFDSTypeAnalysis::d_t>
+    FFSet<IFDSTypeAnalysis::d_t>
     computeTargets(IFDSTypeAnalysis::d_t source) override {
-      return set<IFDSTypeAnalysis::d_t>{};
+      return {};
     }
   };
   return make_shared<TAFF>();
@@ -76,9 +76,9 @@ IFDSTypeAnalysis::getCallToRetFlowFunction(IFDSTypeAnalysis::n_t callSite,
                                            set<IFDSTypeAnalysis::m_t> callees) {
   cout << "type analysis getCallToRetFlowFunction()" << endl;
   struct TAFF : FlowFunction<IFDSTypeAnalysis::d_t> {
-    set<IFDSTypeAnalysis::d_t>
+    FFSet<IFDSTypeAnalysis::d_t>
     computeTargets(IFDSTypeAnalysis::d_t source) override {
-      return set<IFDSTypeAnalysis::d_t>{};
+      return {};
     }
   };
   return make_shared<TAFF>();
@@ -7,6 +7,8 @@
  *     Philipp Schubert and others
  *****************************************************************************/
 
+#include <algorithm>
+
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/LLVMContext.h>
@@ -55,10 +57,10 @@ IFDSUnitializedVariables::getNormalFlowFunction(
       IFDSUnitializedVariables::d_t zerovalue;
       UVFF(const llvm::Function *f, IFDSUnitializedVariables::d_t zv)
           : func(f), zerovalue(zv) {}
-      set<IFDSUnitializedVariables::d_t>
+      FFSet<IFDSUnitializedVariables::d_t>
       computeTargets(IFDSUnitializedVariables::d_t source) override {
         if (source == zerovalue) {
-          set<IFDSUnitializedVariables::d_t> res;
+          FFSet<IFDSUnitializedVariables::d_t> res;
           // first add all local values of primitive types
           for (auto &BB : *func) {
             for (auto &inst : BB) {
@@ -68,13 +70,13 @@ IFDSUnitializedVariables::getNormalFlowFunction(
                     alloc->getAllocatedType()->isFloatingPointTy() ||
                     alloc->getAllocatedType()->isPointerTy() ||
                     alloc->getAllocatedType()->isArrayTy()) {
-                  res.insert(alloc);
+                  res.push_back(alloc);
                 }
               } else {
                 // collect all instructions that use an undef literal
                 for (auto &operand : inst.operands()) {
                   if (llvm::isa<llvm::UndefValue>(&operand)) {
-                    res.insert(&inst);
+                    res.push_back(&inst);
                   }
                 }
               }
@@ -82,9 +84,9 @@ IFDSUnitializedVariables::getNormalFlowFunction(
           }
           // remove function parameters of entry function
           for (auto &arg : func->args()) {
-            res.erase(&arg);
+            res.erase(std::remove(res.begin(), res.end(), &arg), res.end());
           }
-          res.insert(zerovalue);
+          res.push_back(zerovalue);
           return res;
         }
         return {};
@@ -105,7 +107,7 @@ IFDSUnitializedVariables::getNormalFlowFunction(
            map<IFDSUnitializedVariables::n_t,
                set<IFDSUnitializedVariables::d_t>> &UVU)
           : store(s), UndefValueUses(UVU) {}
-      set<IFDSUnitializedVariables::d_t>
+      FFSet<IFDSUnitializedVariables::d_t>
       computeTargets(IFDSUnitializedVariables::d_t source) override {
         // check if an uninitialized value is loaded and stored in a variable
         for (auto &use : store->getValueOperand()->uses()) {
@@ -155,7 +157,7 @@ IFDSUnitializedVariables::getNormalFlowFunction(
          map<IFDSUnitializedVariables::n_t, set<IFDSUnitializedVariables::d_t>>
              &UVU)
         : inst(inst), UndefValueUses(UVU) {}
-    set<IFDSUnitializedVariables::d_t>
+    FFSet<IFDSUnitializedVariables::d_t>
     computeTargets(IFDSUnitializedVariables::d_t source) override {
       for (auto &operand : inst->operands()) {
         const llvm::UndefValue *undef =
@@ -203,24 +205,24 @@ IFDSUnitializedVariables::getCallFlowFunction(
         }
       }
 
-      set<IFDSUnitializedVariables::d_t>
+      FFSet<IFDSUnitializedVariables::d_t>
       computeTargets(IFDSUnitializedVariables::d_t source) override {
         // perform parameter passing
         if (source != zerovalue) {
-          set<const llvm::Value *> res;
+          FFSet<IFDSUnitializedVariables::d_t> res;
           // do the mapping from actual to formal parameters
           // caution: the loop iterates from 0 to formals.size(),
           // rather than actuals.size() as we may have more actual
           // than formal arguments in case of C-style varargs
           for (unsigned idx = 0; idx < formals.size(); ++idx) {
             if (source == actuals[idx]) {
-              res.insert(formals[idx]);
+              res.push_back(formals[idx]);
             }
           }
           return res;
         } else {
           // on zerovalue -> gen all locals parameter
-          set<const llvm::Value *> res;
+          FFSet<IFDSUnitializedVariables::d_t> res;
           for (auto &BB : *destMthd) {
             for (auto &inst : BB) {
               if (auto alloc = llvm::dyn_cast<llvm::AllocaInst>(&inst)) {
@@ -229,13 +231,13 @@ IFDSUnitializedVariables::getCallFlowFunction(
                     alloc->getAllocatedType()->isFloatingPointTy() ||
                     alloc->getAllocatedType()->isPointerTy() ||
                     alloc->getAllocatedType()->isArrayTy()) {
-                  res.insert(alloc);
+                  res.push_back(alloc);
                 }
               } else {
                 // check for instructions using undef value directly
                 for (auto &operand : inst.operands()) {
                   if (llvm::isa<llvm::UndefValue>(&operand)) {
-                    res.insert(&inst);
+                    res.push_back(&inst);
                   }
                 }
               }
@@ -267,7 +269,7 @@ IFDSUnitializedVariables::getRetFlowFunction(
       const llvm::Instruction *exit;
       UVFF(llvm::ImmutableCallSite c, const llvm::Instruction *e)
           : call(c), exit(e) {}
-      set<IFDSUnitializedVariables::d_t>
+      FFSet<IFDSUnitializedVariables::d_t>
       computeTargets(IFDSUnitializedVariables::d_t source) override {
         // check if we return an uninitialized value
         if (exit->getNumOperands() > 0 && exit->getOperand(0) == source) {
@@ -319,6 +321,23 @@ IFDSUnitializedVariables::initialSeeds() {
   return SeedMap;
 }
 
+bool IFDSUnitializedVariables::mayAffect(IFDSUnitializedVariables::n_t n,
+                                         IFDSUnitializedVariables::d_t d) {
+  // the entry point generates the uninitialized locals and stores are
+  // handled specially, all other instructions only generate facts if they
+  // use the fact or an undef literal, see getNormalFlowFunction()
+  if ((icfg.isStartPoint(n) && n->getFunction()->getName().str() == "main") ||
+      llvm::isa<llvm::StoreInst>(n)) {
+    return true;
+  }
+  for (auto &operand : n->operands()) {
+    if (operand == d || llvm::isa<llvm::UndefValue>(operand)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 IFDSUnitializedVariables::d_t IFDSUnitializedVariables::createZeroValue() {
   auto &lg = lg::get();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
@@ -17,7 +17,7 @@ using namespace psr;
 namespace psr {
 
 // Return value is modeled as -1
-const std::map<std::string, std::set<int>>
+const std::unordered_map<std::string, std::set<int>>
     CSTDFILEIOTypeStateDescription::StdFileIOFuncs = {
         {"fopen", {-1}},   {"fdopen", {-1}},   {"fclose", {0}},
         {"fread", {3}},    {"fwrite", {3}},    {"fgetc", {0}},
@@ -50,16 +50,18 @@ const CSTDFILEIOTypeStateDescription::CSTDFILEIOState
 
 bool CSTDFILEIOTypeStateDescription::isFactoryFunction(
     const std::string &F) const {
-  if (isAPIFunction(F)) {
-    return StdFileIOFuncs.at(F).find(-1) != StdFileIOFuncs.at(F).end();
+  auto Search = StdFileIOFuncs.find(F);
+  if (Search != StdFileIOFuncs.end()) {
+    return Search->second.count(-1);
   }
   return false;
 }
 
 bool CSTDFILEIOTypeStateDescription::isConsumingFunction(
     const std::string &F) const {
-  if (isAPIFunction(F)) {
-    return StdFileIOFuncs.at(F).find(-1) == StdFileIOFuncs.at(F).end();
+  auto Search = StdFileIOFuncs.find(F);
+  if (Search != StdFileIOFuncs.end()) {
+    return !Search->second.count(-1);
   }
   return false;
 }
@@ -68,6 +70,21 @@ bool CSTDFILEIOTypeStateDescription::isAPIFunction(const std::string &F) const {
   return StdFileIOFuncs.find(F) != StdFileIOFuncs.end();
 }
 
+std::vector<std::string>
+CSTDFILEIOTypeStateDescription::getAPIFunctions() const {
+  std::vector<std::string> Funcs;
+  for (auto &Entry : StdFileIOFuncs) {
+    Funcs.push_back(Entry.first);
+  }
+  return Funcs;
+}
+
+std::vector<TypeStateDescription::State>
+CSTDFILEIOTypeStateDescription::getStates() const {
+  return {CSTDFILEIOState::UNINIT, CSTDFILEIOState::OPENED,
+          CSTDFILEIOState::CLOSED, CSTDFILEIOState::ERROR};
+}
+
 TypeStateDescription::State CSTDFILEIOTypeStateDescription::getNextState(
     std::string Tok, TypeStateDescription::State S) const {
   if (isAPIFunction(Tok)) {
@@ -84,8 +101,9 @@ std::string CSTDFILEIOTypeStateDescription::getTypeNameOfInterest() const {
 
 set<int> CSTDFILEIOTypeStateDescription::getConsumerParamIdx(
     const std::string &F) const {
-  if (isConsumingFunction(F)) {
-    return StdFileIOFuncs.at(F);
+  auto Search = StdFileIOFuncs.find(F);
+  if (Search != StdFileIOFuncs.end() && !Search->second.count(-1)) {
+    return Search->second;
   }
   return {};
 }
@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Copyright (c) 2018 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <limits>
+#include <stdexcept>
+
+#include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/TypeStateTransitionTable.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+TypeStateTransitionTable::TypeStateTransitionTable(
+    const TypeStateDescription &TSD)
+    : TSD(TSD) {
+  States.push_back(TSD.top());
+  States.push_back(TSD.bottom());
+  for (auto S : TSD.getStates()) {
+    States.push_back(S);
+  }
+  if (States.size() > numeric_limits<StateIdx>::max()) {
+    throw runtime_error("type state description has too many states");
+  }
+  for (size_t I = 0; I < States.size(); ++I) {
+    StateIndices[States[I]] = static_cast<StateIdx>(I);
+  }
+  const size_t NumStates = States.size();
+  for (auto &F : TSD.getAPIFunctions()) {
+    FunctionId Id = Functions.getId(F);
+    Delta.resize((Id + 1) * NumStates);
+    Delta[Id * NumStates + TopIdx] = TopIdx;
+    Delta[Id * NumStates + BottomIdx] = BottomIdx;
+    for (size_t S = BottomIdx + 1; S < NumStates; ++S) {
+      Delta[Id * NumStates + S] = getStateIdx(TSD.getNextState(F, States[S]));
+    }
+  }
+  // We have a one-level lattice, see IDETypeStateAnalysis::join()
+  Joins.resize(NumStates * NumStates);
+  for (size_t S1 = 0; S1 < NumStates; ++S1) {
+    for (size_t S2 = 0; S2 < NumStates; ++S2) {
+      StateIdx J;
+      if (S1 == TopIdx) {
+        J = S2;
+      } else if (S2 == TopIdx || S1 == S2) {
+        J = S1;
+      } else {
+        J = BottomIdx;
+      }
+      Joins[S1 * NumStates + S2] = J;
+    }
+  }
+}
+
+} // namespace psr
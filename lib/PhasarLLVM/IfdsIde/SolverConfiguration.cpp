@@ -16,13 +16,41 @@ using namespace psr;
 
 namespace psr {
 
+ostream &operator<<(ostream &os, const WorkListStrategy &S) {
+  switch (S) {
+  case WorkListStrategy::FIFO:
+    return os << "FIFO";
+  case WorkListStrategy::LIFO:
+    return os << "LIFO";
+  case WorkListStrategy::MethodBatched:
+    return os << "MethodBatched";
+  case WorkListStrategy::ReversePostOrder:
+    return os << "ReversePostOrder";
+  case WorkListStrategy::ExitFirst:
+    return os << "ExitFirst";
+  }
+  return os << "unknown";
+}
+
 ostream &operator<<(ostream &os, const SolverConfiguration &sc) {
   return os << "SolverConfiguration:\n"
             << "\tfollowReturnsPastSeeds: " << sc.followReturnsPastSeeds << "\n"
             << "\tautoAddZero: " << sc.autoAddZero << "\n"
             << "\tcomputeValues: " << sc.computeValues << "\n"
             << "\trecordEdges: " << sc.recordEdges << "\n"
-            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries;
+            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries
+            << "\n"
+            << "\tworkListStrategy: " << sc.workListStrategy << "\n"
+            << "\tnumThreads: " << sc.numThreads << "\n"
+            << "\tedgeFunctionMemoSize: " << sc.edgeFunctionMemoSize << "\n"
+            << "\tflowEdgeFunctionCacheSize: " << sc.flowEdgeFunctionCacheSize
+            << "\n"
+            << "\treleaseFinishedMethods: " << sc.releaseFinishedMethods << "\n"
+            << "\tallocateFromArena: " << sc.allocateFromArena << "\n"
+            << "\tsparsePropagation: " << sc.sparsePropagation << "\n"
+            << "\tlazyValueComputation: " << sc.lazyValueComputation << "\n"
+            << "\tcheckpointFile: " << sc.checkpointFile << "\n"
+            << "\tcheckpointInterval: " << sc.checkpointInterval;
 }
 
 } // namespace psr
@@ -59,7 +59,7 @@ IFDSSimpleTaintAnalysis::getNormalFlowFunction(const llvm::Instruction *curr,
     struct STA : FlowFunction<const llvm::Value *> {
       const llvm::StoreInst *Store;
       STA(const llvm::StoreInst *S) : Store(S) {}
-      set<const llvm::Value *> computeTargets(const llvm::Value *src) {
+      FFSet<const llvm::Value *> computeTargets(const llvm::Value *src) {
         if (Store->getValueOperand() == src) {
           return {Store->getValueOperand(), Store->getPointerOperand()};
         } else {
@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <phasar/Utils/CacheRegistry.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+CacheRegistry &CacheRegistry::getInstance() {
+  static CacheRegistry Instance;
+  return Instance;
+}
+
+void CacheRegistry::release(const void *Scope) {
+  lock_guard<mutex> Lock(Mtx);
+  for (auto It = Caches.begin(); It != Caches.end();) {
+    if (get<0>(It->first) == Scope) {
+      It = Caches.erase(It);
+    } else {
+      ++It;
+    }
+  }
+}
+
+void CacheRegistry::clear() {
+  lock_guard<mutex> Lock(Mtx);
+  Caches.clear();
+}
+
+size_t CacheRegistry::size() const {
+  lock_guard<mutex> Lock(Mtx);
+  return Caches.size();
+}
+
+} // namespace psr
@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+
+#include <phasar/Utils/Checkpoint.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+const char CheckpointMagic[8] = {'P', 'S', 'R', 'C', 'H', 'K', 'P', 'T'};
+
+// the signal may be handled by any thread while the solver's workers poll
+// the flag, hence it is a lock-free atomic rather than a sig_atomic_t
+std::atomic<int> TerminationPending{0};
+static_assert(ATOMIC_INT_LOCK_FREE == 2,
+              "the termination flag must be usable in a signal handler");
+
+extern "C" void handleTermination(int) { TerminationPending = 1; }
+
+} // anonymous namespace
+
+CheckpointWriter::CheckpointWriter(const string &Path, uint32_t Version)
+    : Path(Path), TmpPath(Path + ".tmp"),
+      File(TmpPath, ios::binary | ios::trunc) {
+  if (!File.is_open()) {
+    throw ios_base::failure("could not write file: " + TmpPath);
+  }
+  File.write(CheckpointMagic, sizeof(CheckpointMagic));
+  File.write(reinterpret_cast<const char *>(&Version), sizeof(Version));
+}
+
+CheckpointWriter::~CheckpointWriter() {
+  if (!Committed) {
+    File.close();
+    remove(TmpPath.c_str());
+  }
+}
+
+void CheckpointWriter::writeInt(uint64_t Value) {
+  File.write(reinterpret_cast<const char *>(&Value), sizeof(Value));
+}
+
+void CheckpointWriter::writeString(const string &Str) {
+  size_t Known = Strings.size();
+  uint32_t Id = Strings.getId(Str);
+  File.write(reinterpret_cast<const char *>(&Id), sizeof(Id));
+  // the first occurrence of a string defines its id
+  if (Strings.size() > Known) {
+    writeInt(Str.size());
+    File.write(Str.data(), Str.size());
+  }
+}
+
+void CheckpointWriter::commit() {
+  File.close();
+  if (File.fail() || rename(TmpPath.c_str(), Path.c_str()) != 0) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+  Committed = true;
+}
+
+CheckpointReader::CheckpointReader(const string &Path, uint32_t Version)
+    : Path(Path), File(Path, ios::binary) {
+  if (!File.is_open()) {
+    throw ios_base::failure("could not read file: " + Path);
+  }
+  char Magic[sizeof(CheckpointMagic)];
+  uint32_t FileVersion = 0;
+  File.read(Magic, sizeof(Magic));
+  File.read(reinterpret_cast<char *>(&FileVersion), sizeof(FileVersion));
+  if (!File || memcmp(Magic, CheckpointMagic, sizeof(Magic)) != 0) {
+    throw ios_base::failure("not a checkpoint: " + Path);
+  }
+  if (FileVersion != Version) {
+    throw ios_base::failure("unsupported checkpoint version " +
+                            to_string(FileVersion) + ": " + Path);
+  }
+}
+
+void CheckpointReader::check() {
+  if (!File) {
+    throw ios_base::failure("corrupt checkpoint: " + Path);
+  }
+}
+
+uint64_t CheckpointReader::readInt() {
+  uint64_t Value = 0;
+  File.read(reinterpret_cast<char *>(&Value), sizeof(Value));
+  check();
+  return Value;
+}
+
+const string &CheckpointReader::readString() {
+  uint32_t Id = 0;
+  File.read(reinterpret_cast<char *>(&Id), sizeof(Id));
+  check();
+  if (Id == Strings.size()) {
+    string Str(readInt(), '\0');
+    File.read(&Str[0], Str.size());
+    check();
+    Strings.push_back(move(Str));
+  } else if (Id > Strings.size()) {
+    throw ios_base::failure("corrupt checkpoint: " + Path);
+  }
+  return Strings[Id];
+}
+
+TerminationSignalGuard::TerminationSignalGuard()
+    : PreviousHandler(signal(SIGTERM, handleTermination)) {}
+
+TerminationSignalGuard::~TerminationSignalGuard() {
+  signal(SIGTERM, PreviousHandler);
+}
+
+bool TerminationSignalGuard::isPending() { return TerminationPending; }
+
+void TerminationSignalGuard::forwardSignal() {
+  TerminationPending = 0;
+  signal(SIGTERM, PreviousHandler);
+  raise(SIGTERM);
+  // the previous handler has returned or ignores the signal
+  signal(SIGTERM, handleTermination);
+}
+
+} // namespace psr
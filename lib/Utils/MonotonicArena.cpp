@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+#include <phasar/Utils/Concurrency.h>
+#include <phasar/Utils/MonotonicArena.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+MonotonicArena::MonotonicArena(size_t NumShards, size_t InitialSize) {
+  for (size_t I = 0; I < max<size_t>(NumShards, 1); ++I) {
+    Shards.push_back(make_unique<Shard>(InitialSize));
+  }
+}
+
+void *MonotonicArena::allocate(size_t Bytes, size_t Alignment) {
+  Shard &S = Shards.size() == 1
+                 ? *Shards.front()
+                 : *Shards[shardIndex(this_thread::get_id(), Shards.size())];
+  lock_guard<mutex> Lock(S.Mtx);
+  S.BytesAllocated += Bytes;
+  size_t Space = S.End - S.Cur;
+  void *P = S.Cur;
+  if (!align(Alignment, Bytes, P, Space)) {
+    // the padding that aligns the block never exceeds Alignment - 1 bytes
+    size_t ChunkSize = max(S.NextChunkSize, Bytes + Alignment - 1);
+    S.Chunks.emplace_back(new char[ChunkSize]);
+    S.NextChunkSize = 2 * ChunkSize;
+    P = S.Chunks.back().get();
+    Space = ChunkSize;
+    align(Alignment, Bytes, P, Space);
+    S.End = S.Chunks.back().get() + ChunkSize;
+  }
+  S.Cur = static_cast<char *>(P) + Bytes;
+  return P;
+}
+
+size_t MonotonicArena::getBytesAllocated() const {
+  size_t Bytes = 0;
+  for (const auto &S : Shards) {
+    lock_guard<mutex> Lock(S->Mtx);
+    Bytes += S->BytesAllocated;
+  }
+  return Bytes;
+}
+
+void *allocateFrom(MonotonicArena &Arena, size_t Bytes, size_t Alignment) {
+  return Arena.allocate(Bytes, Alignment);
+}
+
+} // namespace psr
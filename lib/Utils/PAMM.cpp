@@ -126,34 +126,34 @@ std::string PAMM::getPrintableDuration(unsigned long Duration) {
 }
 
 void PAMM::regCounter(const std::string &CounterId, unsigned IntialValue) {
-  bool validCounterId = !Counter.count(CounterId);
-  assert(validCounterId && "regCounter failed due to an invalid counter id");
-  if (validCounterId) {
-    Counter[CounterId] = IntialValue;
-  }
+  std::lock_guard<std::mutex> Lock(CounterMtx);
+  Counter.try_emplace(CounterId, IntialValue);
 }
 
 void PAMM::incCounter(const std::string &CounterId, unsigned CValue) {
-  bool validCounterId = Counter.count(CounterId);
+  auto Search = Counter.find(CounterId);
+  bool validCounterId = Search != Counter.end();
   assert(validCounterId && "incCounter failed due to an invalid counter id");
   if (validCounterId) {
-    Counter[CounterId] += CValue;
+    Search->second.fetch_add(CValue, std::memory_order_relaxed);
   }
 }
 
 void PAMM::decCounter(const std::string &CounterId, unsigned CValue) {
-  bool validCounterId = Counter.count(CounterId);
+  auto Search = Counter.find(CounterId);
+  bool validCounterId = Search != Counter.end();
   assert(validCounterId && "decCounter failed due to an invalid counter id");
   if (validCounterId) {
-    Counter[CounterId] -= CValue;
+    Search->second.fetch_sub(CValue, std::memory_order_relaxed);
   }
 }
 
 int PAMM::getCounter(const std::string &CounterId) {
-  bool validCounterId = Counter.count(CounterId);
+  auto Search = Counter.find(CounterId);
+  bool validCounterId = Search != Counter.end();
   assert(validCounterId && "getCounter failed due to an invalid counter id");
   if (validCounterId) {
-    return Counter[CounterId];
+    return Search->second.load();
   }
   return -1;
 }
@@ -173,17 +173,14 @@ int PAMM::getSumCount(const std::set<std::string> &CounterIds) {
 }
 
 void PAMM::regHistogram(const std::string &HistogramId) {
-  bool validHID = !Histogram.count(HistogramId);
-  assert(validHID && "failed to register new histogram due to an invalid id");
-  if (validHID) {
-    std::unordered_map<std::string, unsigned long> H;
-    Histogram[HistogramId] = H;
-  }
+  std::lock_guard<std::mutex> Lock(HistogramMtx);
+  Histogram.try_emplace(HistogramId);
 }
 
 void PAMM::addToHistogram(const std::string &HistogramId,
                           const std::string &DataPointId,
                           unsigned long DataPointValue) {
+  std::lock_guard<std::mutex> Lock(HistogramMtx);
   bool validHistoID = Histogram.count(HistogramId);
   assert(validHistoID &&
          "adding data point to histogram failed due to invalid id");
@@ -231,8 +228,8 @@ void PAMM::printTimers(std::ostream &os) {
 void PAMM::printCounters(std::ostream &os) {
   os << "\nCounter\n";
   os << "-------\n";
-  for (auto counter : Counter) {
-    os << counter.first << " : " << counter.second << '\n';
+  for (auto &counter : Counter) {
+    os << counter.first << " : " << counter.second.load() << '\n';
   }
   if (Counter.empty()) {
     os << "No Counter registered!\n";
@@ -297,8 +294,8 @@ void PAMM::exportMeasuredData(std::string OutputPath) {
   }
   // add counter data
   json jCounter;
-  for (auto counter : Counter) {
-    jCounter[counter.first] = counter.second;
+  for (auto &counter : Counter) {
+    jCounter[counter.first] = counter.second.load();
   }
   jsonData["Counter"] = jCounter;
 
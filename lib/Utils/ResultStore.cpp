@@ -0,0 +1,312 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <ios>
+#include <numeric>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phasar/Utils/ResultStore.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+template <typename T>
+void writeTable(ofstream &File, const vector<T> &Table) {
+  File.write(reinterpret_cast<const char *>(Table.data()),
+             Table.size() * sizeof(T));
+}
+
+// pads the file such that the next table starts at an aligned offset
+uint64_t alignFile(ofstream &File) {
+  static const char Zeros[8] = {};
+  uint64_t Offset = File.tellp();
+  uint64_t Padding = (8 - Offset % 8) % 8;
+  File.write(Zeros, Padding);
+  return Offset + Padding;
+}
+
+// returns the indices of the given names in the lexicographical order of
+// the names
+vector<uint32_t> sortByName(const vector<string> &AllStrings,
+                            const vector<uint32_t> &Names) {
+  vector<uint32_t> Order(Names.size());
+  iota(Order.begin(), Order.end(), 0);
+  stable_sort(Order.begin(), Order.end(), [&](uint32_t A, uint32_t B) {
+    return AllStrings[Names[A]] < AllStrings[Names[B]];
+  });
+  return Order;
+}
+
+} // anonymous namespace
+
+ResultStoreWriter::ResultStoreWriter(const string &Path)
+    : File(Path, ios::binary | ios::trunc), Path(Path) {
+  if (!File.is_open()) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+  // the header is written by finish() once the offsets are known
+  resultstore::Header Placeholder{};
+  File.write(reinterpret_cast<const char *>(&Placeholder), sizeof(Placeholder));
+}
+
+ResultStoreWriter::~ResultStoreWriter() {
+  if (Finished) {
+    return;
+  }
+  // destructors must not throw, call finish() to handle write errors
+  try {
+    finish();
+  } catch (const ios_base::failure &) {
+  }
+}
+
+void ResultStoreWriter::flushNode() {
+  if (Nodes.empty() || PendingRecords.empty()) {
+    return;
+  }
+  sort(PendingRecords.begin(), PendingRecords.end(),
+       [](const resultstore::Record &A, const resultstore::Record &B) {
+         return A.Fact < B.Fact;
+       });
+  writeTable(File, PendingRecords);
+  Nodes.back().NumRecords = PendingRecords.size();
+  NumRecords += PendingRecords.size();
+  PendingRecords.clear();
+}
+
+void ResultStoreWriter::beginFunction(const string &Name) {
+  assert(!Finished && "result store has been finished already");
+  flushNode();
+  Functions.push_back({Strings.getId(Name),
+                       static_cast<uint32_t>(Nodes.size()), 0, 0});
+}
+
+void ResultStoreWriter::beginNode(const string &Name) {
+  assert(!Functions.empty() && "nodes must belong to a function");
+  flushNode();
+  uint32_t Id = NodeNames.getId(Name);
+  assert(Id == Nodes.size() && "node has been added before");
+  Nodes.push_back({Strings.getId(Name),
+                   static_cast<uint32_t>(Functions.size() - 1), 0, 0,
+                   NumRecords});
+  ++Functions.back().NumNodes;
+}
+
+void ResultStoreWriter::addResult(const string &Fact, const string &Value) {
+  assert(!Nodes.empty() && "results must belong to a node");
+  uint32_t Id = FactNames.getId(Fact);
+  if (Id == FactStrings.size()) {
+    FactStrings.push_back(Strings.getId(Fact));
+  }
+  PendingRecords.push_back({Id, Strings.getId(Value)});
+}
+
+void ResultStoreWriter::finish() {
+  if (Finished) {
+    return;
+  }
+  flushNode();
+  Finished = true;
+  vector<string> AllStrings(Strings.size());
+  for (uint32_t Id = 0; Id < AllStrings.size(); ++Id) {
+    AllStrings[Id] = Strings.get(Id);
+  }
+  vector<uint32_t> FunctionNames, NodeNameIds;
+  for (const auto &F : Functions) {
+    FunctionNames.push_back(F.Name);
+  }
+  for (const auto &N : Nodes) {
+    NodeNameIds.push_back(N.Name);
+  }
+  resultstore::Header Hdr{};
+  memcpy(Hdr.Magic, resultstore::Magic, sizeof(Hdr.Magic));
+  Hdr.Version = resultstore::Version;
+  Hdr.NumFunctions = Functions.size();
+  Hdr.NumNodes = Nodes.size();
+  Hdr.NumFacts = FactStrings.size();
+  Hdr.NumStrings = AllStrings.size();
+  Hdr.NumRecords = NumRecords;
+  Hdr.RecordsOffset = sizeof(resultstore::Header);
+  Hdr.FunctionsOffset = alignFile(File);
+  writeTable(File, Functions);
+  Hdr.FunctionsByNameOffset = alignFile(File);
+  writeTable(File, sortByName(AllStrings, FunctionNames));
+  Hdr.NodesOffset = alignFile(File);
+  writeTable(File, Nodes);
+  Hdr.NodesByNameOffset = alignFile(File);
+  writeTable(File, sortByName(AllStrings, NodeNameIds));
+  Hdr.FactsOffset = alignFile(File);
+  writeTable(File, FactStrings);
+  Hdr.FactsByNameOffset = alignFile(File);
+  writeTable(File, sortByName(AllStrings, FactStrings));
+  Hdr.StringOffsetsOffset = alignFile(File);
+  vector<uint64_t> StringOffsets(AllStrings.size() + 1, 0);
+  for (size_t Id = 0; Id < AllStrings.size(); ++Id) {
+    StringOffsets[Id + 1] = StringOffsets[Id] + AllStrings[Id].size();
+  }
+  writeTable(File, StringOffsets);
+  Hdr.StringDataOffset = File.tellp();
+  for (const auto &Str : AllStrings) {
+    File.write(Str.data(), Str.size());
+  }
+  File.seekp(0);
+  File.write(reinterpret_cast<const char *>(&Hdr), sizeof(Hdr));
+  File.close();
+  if (File.fail()) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+}
+
+ResultStore::ResultStore(const string &Path) {
+  int FD = open(Path.c_str(), O_RDONLY);
+  if (FD < 0) {
+    throw ios_base::failure("could not read file: " + Path);
+  }
+  struct stat Stat;
+  if (fstat(FD, &Stat) == 0 && Stat.st_size > 0) {
+    Size = Stat.st_size;
+    void *Mapping = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, FD, 0);
+    Data = Mapping != MAP_FAILED ? static_cast<const char *>(Mapping) : nullptr;
+  }
+  close(FD);
+  if (!Data) {
+    throw ios_base::failure("could not read file: " + Path);
+  }
+  Hdr = table<resultstore::Header>(0);
+  bool Valid =
+      Size >= sizeof(resultstore::Header) &&
+      memcmp(Hdr->Magic, resultstore::Magic, sizeof(Hdr->Magic)) == 0 &&
+      Hdr->Version == resultstore::Version &&
+      Hdr->StringDataOffset <= Size &&
+      Hdr->StringOffsetsOffset + (Hdr->NumStrings + 1) * sizeof(uint64_t) <=
+          Hdr->StringDataOffset &&
+      Hdr->StringDataOffset +
+              table<uint64_t>(Hdr->StringOffsetsOffset)[Hdr->NumStrings] <=
+          Size;
+  if (!Valid) {
+    munmap(const_cast<char *>(Data), Size);
+    throw ios_base::failure("not a result store: " + Path);
+  }
+}
+
+ResultStore::~ResultStore() { munmap(const_cast<char *>(Data), Size); }
+
+string_view ResultStore::getString(uint32_t Id) const {
+  assert(Id < Hdr->NumStrings && "unknown string id");
+  const uint64_t *Offsets = table<uint64_t>(Hdr->StringOffsetsOffset);
+  return string_view(Data + Hdr->StringDataOffset + Offsets[Id],
+                     Offsets[Id + 1] - Offsets[Id]);
+}
+
+optional<uint32_t> ResultStore::findByName(uint64_t ByNameOffset,
+                                           uint32_t Count,
+                                           uint64_t NamesOffset, size_t Stride,
+                                           string_view Name) const {
+  const uint32_t *ByName = table<uint32_t>(ByNameOffset);
+  auto NameOf = [&](uint32_t Idx) {
+    return getString(*table<uint32_t>(NamesOffset + Idx * Stride));
+  };
+  const uint32_t *It = lower_bound(
+      ByName, ByName + Count, Name,
+      [&](uint32_t Idx, string_view Key) { return NameOf(Idx) < Key; });
+  if (It == ByName + Count || NameOf(*It) != Name) {
+    return nullopt;
+  }
+  return *It;
+}
+
+optional<uint32_t> ResultStore::findNode(string_view Name) const {
+  return findByName(Hdr->NodesByNameOffset, Hdr->NumNodes, Hdr->NodesOffset,
+                    sizeof(resultstore::Node), Name);
+}
+
+optional<uint32_t> ResultStore::findFact(string_view Name) const {
+  return findByName(Hdr->FactsByNameOffset, Hdr->NumFacts, Hdr->FactsOffset,
+                    sizeof(uint32_t), Name);
+}
+
+optional<string_view> ResultStore::resultAt(string_view Node,
+                                            string_view Fact) const {
+  optional<uint32_t> NodeId = findNode(Node);
+  optional<uint32_t> FactId = findFact(Fact);
+  if (!NodeId || !FactId) {
+    return nullopt;
+  }
+  const resultstore::Node &N =
+      table<resultstore::Node>(Hdr->NodesOffset)[*NodeId];
+  const resultstore::Record *First =
+      table<resultstore::Record>(Hdr->RecordsOffset) + N.FirstRecord;
+  const resultstore::Record *Last = First + N.NumRecords;
+  const resultstore::Record *It = lower_bound(
+      First, Last, *FactId,
+      [](const resultstore::Record &R, uint32_t Id) { return R.Fact < Id; });
+  if (It == Last || It->Fact != *FactId) {
+    return nullopt;
+  }
+  return getString(It->Value);
+}
+
+vector<pair<string_view, string_view>>
+ResultStore::resultsAt(string_view Node) const {
+  vector<pair<string_view, string_view>> Results;
+  optional<uint32_t> NodeId = findNode(Node);
+  if (!NodeId) {
+    return Results;
+  }
+  const resultstore::Node &N =
+      table<resultstore::Node>(Hdr->NodesOffset)[*NodeId];
+  const resultstore::Record *Records =
+      table<resultstore::Record>(Hdr->RecordsOffset) + N.FirstRecord;
+  const uint32_t *Facts = table<uint32_t>(Hdr->FactsOffset);
+  for (uint32_t Idx = 0; Idx < N.NumRecords; ++Idx) {
+    Results.emplace_back(getString(Facts[Records[Idx].Fact]),
+                         getString(Records[Idx].Value));
+  }
+  return Results;
+}
+
+vector<string_view> ResultStore::functions() const {
+  vector<string_view> Names;
+  const resultstore::Function *Functions =
+      table<resultstore::Function>(Hdr->FunctionsOffset);
+  for (uint32_t Idx = 0; Idx < Hdr->NumFunctions; ++Idx) {
+    Names.push_back(getString(Functions[Idx].Name));
+  }
+  return Names;
+}
+
+vector<string_view> ResultStore::nodesOf(string_view Function) const {
+  vector<string_view> Names;
+  optional<uint32_t> FunctionId =
+      findByName(Hdr->FunctionsByNameOffset, Hdr->NumFunctions,
+                 Hdr->FunctionsOffset, sizeof(resultstore::Function), Function);
+  if (!FunctionId) {
+    return Names;
+  }
+  const resultstore::Function &F =
+      table<resultstore::Function>(Hdr->FunctionsOffset)[*FunctionId];
+  const resultstore::Node *Nodes = table<resultstore::Node>(Hdr->NodesOffset);
+  for (uint32_t Idx = F.FirstNode; Idx < F.FirstNode + F.NumNodes; ++Idx) {
+    Names.push_back(getString(Nodes[Idx].Name));
+  }
+  return Names;
+}
+
+} // namespace psr
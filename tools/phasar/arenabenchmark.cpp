@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+// Compares the running times of the taint and the linear constant analysis
+// on the given module with SolverConfiguration::allocateFromArena disabled
+// and enabled. The solvers are destroyed within the measured time, since
+// the arena is freed along with their caches.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IDELinearConstantAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSTaintAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIDESolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIFDSSolver.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+#include <phasar/PhasarLLVM/Utils/TaintSensitiveFunctions.h>
+#include <phasar/Utils/CacheRegistry.h>
+#include <phasar/Utils/Logger.h>
+
+namespace bfs = boost::filesystem;
+
+using namespace std;
+using namespace psr;
+
+// Returns the shortest of Runs runs of Analysis in milliseconds.
+template <typename Fn> long long fastestRun(unsigned Runs, Fn Analysis) {
+  long long Fastest = numeric_limits<long long>::max();
+  for (unsigned Run = 0; Run < Runs; ++Run) {
+    auto Start = chrono::steady_clock::now();
+    Analysis();
+    auto Stop = chrono::steady_clock::now();
+    Fastest = min<long long>(
+        Fastest,
+        chrono::duration_cast<chrono::milliseconds>(Stop - Start).count());
+  }
+  return Fastest;
+}
+
+int main(int argc, const char **argv) {
+  if (argc < 2 || !bfs::exists(argv[1]) || bfs::is_directory(argv[1])) {
+    cerr << "usage: <prog> <ir file> [<runs>]\n";
+    return 1;
+  }
+  unsigned Runs = argc > 2 ? max(atoi(argv[2]), 1) : 5;
+  initializeLogger(false);
+  ProjectIRDB DB({argv[1]}, IRDBOptions::WPA);
+  DB.preprocessIR();
+  if (!DB.getFunction("main")) {
+    cerr << "error: file does not contain a 'main' function!\n";
+    return 1;
+  }
+  LLVMTypeHierarchy H(DB);
+  LLVMBasedICFG I(H, DB, CallGraphAnalysisType::OTF, {"main"});
+  TaintSensitiveFunctions TSF;
+  for (bool UseArena : {false, true}) {
+    long long Taint = fastestRun(Runs, [&] {
+      IFDSTaintAnalysis Problem(I, H, DB, TSF, {"main"});
+      Problem.solver_config.allocateFromArena = UseArena;
+      LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> Solver(
+          Problem, false, false);
+      Solver.solve();
+    });
+    long long LCA = fastestRun(Runs, [&] {
+      IDELinearConstantAnalysis Problem(I, H, DB, {"main"});
+      Problem.solver_config.allocateFromArena = UseArena;
+      {
+        LLVMIDESolver<const llvm::Value *, int64_t, LLVMBasedICFG &> Solver(
+            Problem, false, false);
+        Solver.solve();
+      }
+      // the problem reports a cache key, each run shall start from scratch
+      CacheRegistry::getInstance().release(&I);
+    });
+    cout << "allocateFromArena: " << UseArena << "\n  taint: " << Taint
+         << " ms\n  linear constants: " << LCA << " ms\n";
+  }
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionComposer.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionMemo.h>
+
+using namespace psr;
+
+static unsigned NumCompositions = 0;
+
+struct AddEF : EdgeFunction<int>, std::enable_shared_from_this<AddEF> {
+  const int Summand;
+  AddEF(int Summand) : Summand(Summand){};
+  int computeTarget(int source) override { return source + Summand; };
+  std::shared_ptr<EdgeFunction<int>>
+  composeWith(std::shared_ptr<EdgeFunction<int>> secondFunction) override {
+    ++NumCompositions;
+    if (auto *Other = dynamic_cast<AddEF *>(secondFunction.get())) {
+      return std::make_shared<AddEF>(Summand + Other->Summand);
+    }
+    return std::make_shared<AllBottom<int>>(-1);
+  }
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> otherFunction) override {
+    if (otherFunction->equal_to(this->shared_from_this())) {
+      return this->shared_from_this();
+    }
+    return std::make_shared<AllBottom<int>>(-1);
+  };
+  bool equal_to(std::shared_ptr<EdgeFunction<int>> other) const override {
+    if (auto *Other = dynamic_cast<AddEF *>(other.get())) {
+      return Summand == Other->Summand;
+    }
+    return false;
+  }
+  size_t hash() const override { return std::hash<int>()(Summand); }
+};
+
+TEST(EdgeFunctionMemoTest, HandleCanonicalization) {
+  EdgeFunctionMemo<int> Memo(16);
+  auto A = Memo.canonicalize(std::make_shared<AddEF>(1));
+  auto B = Memo.canonicalize(std::make_shared<AddEF>(1));
+  auto C = Memo.canonicalize(std::make_shared<AddEF>(2));
+  ASSERT_EQ(A, B);
+  ASSERT_NE(A, C);
+  auto Bot = Memo.canonicalize(std::make_shared<AllBottom<int>>(-1));
+  ASSERT_EQ(Bot, Memo.canonicalize(std::make_shared<AllBottom<int>>(-1)));
+}
+
+TEST(EdgeFunctionMemoTest, HandleMemoizedCompose) {
+  EdgeFunctionMemo<int> Memo(16);
+  NumCompositions = 0;
+  std::shared_ptr<EdgeFunction<int>> One = std::make_shared<AddEF>(1);
+  std::shared_ptr<EdgeFunction<int>> Two = std::make_shared<AddEF>(2);
+  auto R1 = Memo.compose(One, Two);
+  auto R2 = Memo.compose(One, Two);
+  ASSERT_EQ(NumCompositions, 1u);
+  ASSERT_EQ(R1, R2);
+  ASSERT_EQ(R1->computeTarget(0), 3);
+  // a different composition with an equal result yields the same instance
+  auto R3 = Memo.compose(Two, One);
+  ASSERT_EQ(NumCompositions, 2u);
+  ASSERT_EQ(R1, R3);
+  // joins are memoized as well
+  ASSERT_EQ(Memo.join(R1, R3), R1);
+}
+
+TEST(EdgeFunctionMemoTest, HandleDisabledMemo) {
+  EdgeFunctionMemo<int> Memo(0);
+  NumCompositions = 0;
+  std::shared_ptr<EdgeFunction<int>> One = std::make_shared<AddEF>(1);
+  Memo.compose(One, One);
+  Memo.compose(One, One);
+  ASSERT_EQ(NumCompositions, 2u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionPtr.h>
+#include <set>
+#include <utility>
+
+using namespace psr;
+
+struct AddEF : EdgeFunction<int>, std::enable_shared_from_this<AddEF> {
+  const int Summand;
+  AddEF(int Summand) : Summand(Summand){};
+  int computeTarget(int source) override { return source + Summand; };
+  std::shared_ptr<EdgeFunction<int>>
+  composeWith(std::shared_ptr<EdgeFunction<int>> secondFunction) override {
+    if (auto *Other = dynamic_cast<AddEF *>(secondFunction.get())) {
+      return std::make_shared<AddEF>(Summand + Other->Summand);
+    }
+    if (dynamic_cast<EdgeIdentity<int> *>(secondFunction.get())) {
+      return this->shared_from_this();
+    }
+    return secondFunction;
+  }
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> otherFunction) override {
+    if (otherFunction->equal_to(this->shared_from_this()) ||
+        dynamic_cast<AllTop<int> *>(otherFunction.get())) {
+      return this->shared_from_this();
+    }
+    return std::make_shared<AllBottom<int>>(-1);
+  };
+  bool equal_to(std::shared_ptr<EdgeFunction<int>> other) const override {
+    if (auto *Other = dynamic_cast<AddEF *>(other.get())) {
+      return Summand == Other->Summand;
+    }
+    return false;
+  }
+};
+
+using EFPtr = EdgeFunctionPtr<int>;
+
+TEST(EdgeFunctionPtrTest, HandleTrivialFunctions) {
+  EFPtr Id = EdgeIdentity<int>::getInstance();
+  EFPtr Top = std::make_shared<AllTop<int>>(1000);
+  EFPtr Bot = std::make_shared<AllBottom<int>>(-1);
+  EFPtr Add = std::make_shared<AddEF>(2);
+  EXPECT_EQ(EFPtr::Kind::Identity, Id.kind());
+  EXPECT_EQ(EFPtr::Kind::AllTop, Top.kind());
+  EXPECT_EQ(EFPtr::Kind::AllBottom, Bot.kind());
+  EXPECT_TRUE(Add.isShared());
+  EXPECT_FALSE(EFPtr());
+  EXPECT_TRUE(Id);
+  EXPECT_EQ(5, Id.computeTarget(5));
+  EXPECT_EQ(1000, Top.computeTarget(5));
+  EXPECT_EQ(-1, Bot.computeTarget(5));
+  EXPECT_EQ(7, Add.computeTarget(5));
+  EXPECT_TRUE(Top.equal_to(EFPtr(std::make_shared<AllTop<int>>(1000))));
+  EXPECT_FALSE(Top.equal_to(EFPtr(std::make_shared<AllTop<int>>(0))));
+  EXPECT_FALSE(Top.equal_to(Bot));
+  EXPECT_TRUE(Id.equal_to(EFPtr::identity()));
+  EXPECT_FALSE(Id.equal_to(Add));
+  EXPECT_EQ("AllBottom", Bot.str());
+  // a string does not fit into a handle
+  EXPECT_TRUE(EdgeFunctionPtr<std::string>(
+                  std::make_shared<AllTop<std::string>>("top"))
+                  .isShared());
+}
+
+TEST(EdgeFunctionPtrTest, HandleComposeAndJoin) {
+  EFPtr Id = EFPtr::identity();
+  EFPtr Top = std::make_shared<AllTop<int>>(1000);
+  EFPtr Bot = std::make_shared<AllBottom<int>>(-1);
+  EFPtr Add = std::make_shared<AddEF>(2);
+  // the results match the ones of the edge function classes
+  EXPECT_TRUE(Id.composeWith(Add).equal_to(Add));
+  EXPECT_TRUE(Add.composeWith(Id).equal_to(Add));
+  EXPECT_TRUE(Top.composeWith(Add).equal_to(Top));
+  EXPECT_TRUE(Bot.composeWith(Id).equal_to(Bot));
+  EXPECT_TRUE(Bot.composeWith(Add).equal_to(Add));
+  EXPECT_EQ(9, Add.composeWith(Add).composeWith(Add).computeTarget(3));
+  EXPECT_TRUE(Top.joinWith(Add).equal_to(Add));
+  EXPECT_TRUE(Add.joinWith(Top).equal_to(Add));
+  EXPECT_TRUE(Bot.joinWith(Add).equal_to(Bot));
+  EXPECT_TRUE(Id.joinWith(Top).equal_to(Id));
+  EXPECT_TRUE(Id.joinWith(Bot).equal_to(Bot));
+  EXPECT_EQ(EFPtr::Kind::AllBottom, Id.joinWith(Add).kind());
+  EXPECT_EQ(EFPtr::Kind::AllBottom, Add.joinWith(Id).kind());
+}
+
+TEST(EdgeFunctionPtrTest, HandleCanonicalFunctions) {
+  std::shared_ptr<EdgeFunction<int>> TopF = std::make_shared<AllTop<int>>(42);
+  EFPtr Top = TopF;
+  // the instance a handle has been created from is reused by get()
+  EXPECT_EQ(TopF, Top.get());
+  EXPECT_EQ(TopF, EFPtr(std::make_shared<AllTop<int>>(42)).get());
+  EXPECT_EQ(7, EFPtr(std::make_shared<AllTop<int>>(7)).get()->computeTarget(0));
+  // a shared function never equals an inline one
+  EFPtr Add = std::make_shared<AddEF>(2);
+  EXPECT_FALSE(Add.equal_to(Top));
+  EXPECT_FALSE(Add.equal_to(EFPtr::identity()));
+}
+
+TEST(EdgeFunctionPtrTest, HandleCopies) {
+  std::shared_ptr<EdgeFunction<int>> Add = std::make_shared<AddEF>(2);
+  {
+    EFPtr A = Add;
+    EFPtr B = A;
+    EXPECT_EQ(3, Add.use_count());
+    EFPtr C = std::move(B);
+    EXPECT_EQ(3, Add.use_count());
+    C = EFPtr::identity();
+    EXPECT_EQ(2, Add.use_count());
+    C = A;
+    EXPECT_EQ(3, Add.use_count());
+    EXPECT_EQ(Add, C.get());
+    std::set<int> Targets;
+    for (EFPtr F : {A, C, EFPtr::identity()}) {
+      Targets.insert(F.computeTarget(1));
+    }
+    EXPECT_EQ(std::set<int>({1, 3}), Targets);
+  }
+  EXPECT_EQ(1, Add.use_count());
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <vector>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Compose.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Gen.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/GenAll.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Identity.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Kill.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/KillAll.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/KillMultiple.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/LambdaFlow.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Transfer.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Union.h>
+#include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+
+using namespace psr;
+
+static const int Zero = 0;
+static const std::vector<int> Sources = {0, 1, 2, 3, 4, 5};
+
+// the batched application must yield the same targets per source fact as
+// the application to a single fact
+static void expectSameTargets(std::shared_ptr<FlowFunction<int>> FF) {
+  TargetBuffer<int> Targets;
+  FF->computeTargetsBatch(Sources, Targets);
+  ASSERT_EQ(Targets.size(), Sources.size());
+  for (size_t Idx = 0; Idx < Sources.size(); ++Idx) {
+    std::set<int> Batched(Targets.begin(Idx), Targets.end(Idx));
+    FFSet<int> Single = FF->computeTargets(Sources[Idx]);
+    EXPECT_EQ(Batched, std::set<int>(Single.begin(), Single.end()))
+        << Sources[Idx];
+  }
+}
+
+TEST(FlowFunctionBatchTest, HandleBasicFlowFunctions) {
+  expectSameTargets(Identity<int>::getInstance());
+  expectSameTargets(KillAll<int>::getInstance());
+  expectSameTargets(std::make_shared<Gen<int>>(7, Zero));
+  expectSameTargets(std::make_shared<GenAll<int>>(std::set<int>{7, 8}, Zero));
+  expectSameTargets(std::make_shared<Kill<int>>(2));
+  expectSameTargets(std::make_shared<KillMultiple<int>>(std::set<int>{1, 3}));
+  expectSameTargets(std::make_shared<Transfer<int>>(4, 1));
+  expectSameTargets(std::make_shared<LambdaFlow<int>>(
+      [](int Source) { return FFSet<int>{Source, Source * 10}; }));
+  expectSameTargets(std::make_shared<ZeroedFlowFunction<int>>(
+      KillAll<int>::getInstance(), Zero));
+}
+
+TEST(FlowFunctionBatchTest, HandleComposedFlowFunctions) {
+  std::vector<std::shared_ptr<FlowFunction<int>>> Funcs = {
+      std::make_shared<Transfer<int>>(4, 1), std::make_shared<Gen<int>>(1, 4),
+      std::make_shared<Kill<int>>(3)};
+  expectSameTargets(Compose<int>::compose(Funcs));
+  expectSameTargets(Union<int>::setunion(Funcs));
+  // targets are reported in the order of the sources
+  TargetBuffer<int> Targets;
+  Compose<int>::compose(Funcs)->computeTargetsBatch({3, 1}, Targets);
+  ASSERT_EQ(Targets.size(), 2);
+  EXPECT_EQ(Targets.begin(0), Targets.end(0));
+  EXPECT_EQ(std::set<int>(Targets.begin(1), Targets.end(1)),
+            (std::set<int>{1, 4}));
+  // like computeTargets(), each step drops the duplicates of a source fact
+  Targets.clear();
+  Compose<int>::compose(
+      {std::make_shared<LambdaFlow<int>>(
+           [](int Source) { return FFSet<int>{Source, Source + 1}; }),
+       std::make_shared<LambdaFlow<int>>(
+           [](int) { return FFSet<int>{Zero}; })})
+      ->computeTargetsBatch({1, 2}, Targets);
+  ASSERT_EQ(Targets.size(), 2);
+  EXPECT_EQ(Targets.end(0) - Targets.begin(0), 1);
+  EXPECT_EQ(Targets.end(1) - Targets.begin(1), 1);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
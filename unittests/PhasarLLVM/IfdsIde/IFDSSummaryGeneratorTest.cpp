@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/InstrTypes.h>
+#include <llvm/IR/Instructions.h>
+
+#include <phasar/Config/Configuration.h>
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Identity.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/LambdaFlow.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Transfer.h>
+#include <phasar/PhasarLLVM/IfdsIde/LLVMIFDSSummaryGenerator.h>
+#include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSSolverTest.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace psr;
+
+static ProjectIRDB *IRDB;
+static LLVMTypeHierarchy *TH;
+
+// The summary generator constructs its problems from the ICFG alone. The
+// normal flow functions follow values through stores, loads and binary
+// operators and are pure, such that contexts may be assembled.
+class ValueFlowProblem : public IFDSSolverTest {
+public:
+  ValueFlowProblem(LLVMBasedICFG &icfg) : IFDSSolverTest(icfg, *TH, *IRDB) {}
+
+  std::shared_ptr<FlowFunction<d_t>> getNormalFlowFunction(n_t curr,
+                                                           n_t succ) override {
+    if (auto Store = llvm::dyn_cast<llvm::StoreInst>(curr)) {
+      return std::make_shared<Transfer<d_t>>(Store->getPointerOperand(),
+                                             Store->getValueOperand());
+    }
+    if (auto Load = llvm::dyn_cast<llvm::LoadInst>(curr)) {
+      return std::make_shared<Transfer<d_t>>(Load, Load->getPointerOperand());
+    }
+    if (auto BinOp = llvm::dyn_cast<llvm::BinaryOperator>(curr)) {
+      return std::make_shared<LambdaFlow<d_t>>([BinOp](d_t Source) {
+        if (Source == BinOp->getOperand(0) || Source == BinOp->getOperand(1)) {
+          return FFSet<d_t>{Source, BinOp};
+        }
+        return FFSet<d_t>{Source};
+      });
+    }
+    return Identity<d_t>::getInstance();
+  }
+};
+
+using ValueFlowSummaryGenerator =
+    LLVMIFDSSummaryGenerator<LLVMBasedICFG &, ValueFlowProblem>;
+
+class TestSummaryGenerator : public ValueFlowSummaryGenerator {
+public:
+  using ValueFlowSummaryGenerator::ValueFlowSummaryGenerator;
+  using ValueFlowSummaryGenerator::solveContext;
+};
+
+/* ============== TEST FIXTURE ============== */
+
+class IFDSSummaryGeneratorTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarDirectory + "build/test/llvm_test_code/summary_generation/";
+  const std::vector<std::string> EntryPoints = {"_Z8functionii"};
+
+  LLVMBasedICFG *ICFG;
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    IRDB = new ProjectIRDB({pathToLLFiles + "summary_2_cpp.ll"});
+    IRDB->preprocessIR();
+    TH = new LLVMTypeHierarchy(*IRDB);
+    ICFG =
+        new LLVMBasedICFG(*TH, *IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  }
+
+  void TearDown() override {
+    delete ICFG;
+    delete TH;
+    delete IRDB;
+  }
+}; // Test Fixture
+
+TEST_F(IFDSSummaryGeneratorTest, PowersetMatchesContextSolves) {
+  const llvm::Function *F = ICFG->getMethod(EntryPoints.front());
+  std::vector<const llvm::Value *> Inputs;
+  for (auto &Arg : F->args()) {
+    Inputs.push_back(&Arg);
+  }
+  TestSummaryGenerator Generator(F, *ICFG, SummaryGenerationStrategy::powerset,
+                                 /*NumThreads*/ 3);
+  auto Summaries = Generator.generateSummaryFlowFunction();
+  ASSERT_EQ(Summaries.size(), 1u << Inputs.size());
+  for (auto &Summary : Summaries) {
+    std::set<const llvm::Value *> Context;
+    for (size_t Idx = 0; Idx < Inputs.size(); ++Idx) {
+      if (Summary.first[Idx]) {
+        Context.insert(Inputs[Idx]);
+      }
+    }
+    auto Expected = Generator.solveContext(Context);
+    Expected.insert(LLVMZeroValue::getInstance());
+    auto Targets = Summary.second->computeTargets(LLVMZeroValue::getInstance());
+    std::set<const llvm::Value *> Assembled(Targets.begin(), Targets.end());
+    EXPECT_EQ(Assembled, Expected);
+    // each input reaches the exit, only the empty context adds no facts
+    EXPECT_EQ(Assembled.size() > 1, !Context.empty());
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeWorkList.h>
+#include <vector>
+
+using namespace psr;
+
+// nodes are encoded as method * 10 + statement to keep the tests readable
+static int methodOf(int n) { return n / 10; }
+
+static std::vector<int> drain(PathEdgeWorkList<int, int, int> &WL) {
+  std::vector<int> Targets;
+  while (!WL.empty()) {
+    Targets.push_back(WL.pop().getTarget());
+  }
+  return Targets;
+}
+
+TEST(PathEdgeWorkListTest, HandleFIFO) {
+  PathEdgeWorkList<int, int, int> WL(WorkListStrategy::FIFO);
+  for (int n : {11, 21, 12}) {
+    WL.push(PathEdge<int, int>(0, n, 0), methodOf(n));
+  }
+  EXPECT_EQ(3u, WL.size());
+  EXPECT_EQ(std::vector<int>({11, 21, 12}), drain(WL));
+  EXPECT_TRUE(WL.empty());
+}
+
+TEST(PathEdgeWorkListTest, HandleLIFO) {
+  PathEdgeWorkList<int, int, int> WL(WorkListStrategy::LIFO);
+  for (int n : {11, 21, 12}) {
+    WL.push(PathEdge<int, int>(0, n, 0), methodOf(n));
+  }
+  EXPECT_EQ(std::vector<int>({12, 21, 11}), drain(WL));
+}
+
+TEST(PathEdgeWorkListTest, HandleMethodBatched) {
+  PathEdgeWorkList<int, int, int> WL(WorkListStrategy::MethodBatched);
+  for (int n : {11, 21, 12, 31, 22}) {
+    WL.push(PathEdge<int, int>(0, n, 0), methodOf(n));
+  }
+  EXPECT_EQ(11, WL.pop().getTarget());
+  // edges that are discovered while processing a method are processed first
+  WL.push(PathEdge<int, int>(0, 13, 0), 1);
+  EXPECT_EQ(std::vector<int>({12, 13, 21, 22, 31}), drain(WL));
+}
+
+TEST(PathEdgeWorkListTest, HandleReversePostOrder) {
+  PathEdgeWorkList<int, int, int> WL(WorkListStrategy::ReversePostOrder);
+  // use the statement number as priority
+  for (int n : {13, 11, 12}) {
+    EXPECT_TRUE(WL.push(PathEdge<int, int>(0, n, 0), methodOf(n), n % 10));
+  }
+  // identical edges are coalesced
+  EXPECT_FALSE(WL.push(PathEdge<int, int>(0, 12, 0), 1, 2));
+  EXPECT_TRUE(WL.push(PathEdge<int, int>(0, 12, 1), 1, 2));
+  EXPECT_EQ(4u, WL.size());
+  EXPECT_EQ(11, WL.pop().getTarget());
+  // the most recently reached method is processed first
+  WL.push(PathEdge<int, int>(0, 22, 0), 2, 2);
+  WL.push(PathEdge<int, int>(0, 21, 0), 2, 1);
+  EXPECT_TRUE(WL.hasPendingEdges(1));
+  EXPECT_EQ(std::vector<int>({21, 22, 12, 12, 13}), drain(WL));
+  EXPECT_FALSE(WL.hasPendingEdges(1));
+}
+
+TEST(PathEdgeWorkListTest, HandleBatches) {
+  for (auto Strategy : {WorkListStrategy::FIFO, WorkListStrategy::LIFO,
+                        WorkListStrategy::MethodBatched,
+                        WorkListStrategy::ReversePostOrder}) {
+    PathEdgeWorkList<int, int, int> WL(Strategy);
+    for (int d : {0, 1, 2}) {
+      WL.push(PathEdge<int, int>(0, 12, d), 1, 2);
+    }
+    WL.push(PathEdge<int, int>(0, 11, 0), 1, 1);
+    std::vector<size_t> Sizes;
+    while (!WL.empty()) {
+      std::vector<PathEdge<int, int>> Batch;
+      WL.popBatch(Batch);
+      for (const auto &Edge : Batch) {
+        EXPECT_EQ(Batch.front().getTarget(), Edge.getTarget());
+      }
+      Sizes.push_back(Batch.size());
+    }
+    // the edges of a node that are handed out in a row form a batch
+    bool InsertionOrder = Strategy == WorkListStrategy::FIFO ||
+                          Strategy == WorkListStrategy::MethodBatched;
+    EXPECT_EQ(InsertionOrder ? std::vector<size_t>({3, 1})
+                             : std::vector<size_t>({1, 3}),
+              Sizes);
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
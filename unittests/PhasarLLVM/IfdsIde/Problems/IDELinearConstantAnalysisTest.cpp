@@ -260,6 +260,66 @@ TEST_F(IDELinearConstantAnalysisTest, HandleCallTest_05) {
   compareResults(gt, llvmlcasolver);
 }
 
+TEST_F(IDELinearConstantAnalysisTest, HandleOnDemandCallTest_01) {
+  Initialize({pathToLLFiles + "call_01_cpp_dbg.ll"});
+  LLVMIDESolver<const llvm::Value *, int64_t, LLVMBasedICFG &> llvmlcasolver(
+      *LCAProblem, false, true);
+  // only query the exit points, which are compared below
+  std::set<const llvm::Instruction *> exits;
+  for (auto M : IRDB->getAllModules()) {
+    for (auto &F : *M) {
+      for (auto exit : ICFG->getExitPointsOf(&F)) {
+        exits.insert(exit);
+      }
+    }
+  }
+  llvmlcasolver.solveFor(exits);
+  const std::map<std::string, int64_t> gt = {
+      {"0", 42}, {"1", 42},  {"5", 42},        {"8", 0},
+      {"9", 42}, {"13", 42}, {"_Z3fooi.0", 42}};
+  compareResults(gt, llvmlcasolver);
+}
+
+TEST_F(IDELinearConstantAnalysisTest, HandleLazyCallTest_02) {
+  Initialize({pathToLLFiles + "call_02_cpp_dbg.ll"});
+  LCAProblem->solver_config.lazyValueComputation = true;
+  LLVMIDESolver<const llvm::Value *, int64_t, LLVMBasedICFG &> llvmlcasolver(
+      *LCAProblem, false, false);
+  llvmlcasolver.solve();
+  const std::map<std::string, int64_t> gt = {
+      {"0", 2},  {"3", 2},   {"4", 42},       {"6", 0},
+      {"7", 42}, {"10", 42}, {"_Z3fooi.0", 2}};
+  compareResults(gt, llvmlcasolver);
+}
+
+/* ============== EDGE FUNCTION TESTS ============== */
+TEST(LinearEdgeFunctionTest, HandleNormalForm) {
+  using LinearEF = IDELinearConstantAnalysis::LinearEdgeFunction;
+  const int64_t BOTTOM = IDELinearConstantAnalysis::BOTTOM;
+  auto Id = EdgeIdentity<int64_t>::getInstance();
+  auto Add3 = LinearEF::create(1, 3);
+  auto Mul4 = LinearEF::create(4, 0);
+  EXPECT_EQ(LinearEF::create(1, 0), Id);
+  // (x + 3) * 4 = 4 * x + 12
+  auto F = Add3->composeWith(Mul4);
+  EXPECT_TRUE(F->equal_to(LinearEF::create(4, 12)));
+  EXPECT_EQ(F->computeTarget(2), 20);
+  EXPECT_EQ(F->computeTarget(BOTTOM), BOTTOM);
+  EXPECT_EQ(LinearEF::create(0, 5)->composeWith(F)->computeTarget(BOTTOM), 32);
+  // 10 - (10 - x) = x
+  auto Sub = LinearEF::create(-1, 10);
+  EXPECT_EQ(Sub->composeWith(Sub), Id);
+  // long chains of compositions stay in the normal form
+  std::shared_ptr<EdgeFunction<int64_t>> G = Id;
+  for (int I = 0; I < 1000; ++I) {
+    G = G->composeWith(Add3);
+  }
+  EXPECT_TRUE(G->equal_to(LinearEF::create(1, 3000)));
+  EXPECT_TRUE(Add3->joinWith(LinearEF::create(1, 3))->equal_to(Add3));
+  auto AllBot = std::make_shared<AllBottom<int64_t>>(BOTTOM);
+  EXPECT_TRUE(Add3->joinWith(Mul4)->equal_to(AllBot));
+}
+
 // main function for the test case
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
@@ -3,6 +3,7 @@
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/IDETypeStateAnalysis.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/CSTDFILEIOTypeStateDescription.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/TypeStateDescriptions/TypeStateTransitionTable.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIDESolver.h>
 #include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
@@ -477,6 +478,42 @@ TEST_F(IDETypeStateAnalysisTest, HandleTypeState_19) {
   compareResults(gt, llvmtssolver);
 }
 
+TEST(TypeStateTransitionTableTest, HandleCompiledStateMachine) {
+  using TSEF = IDETypeStateAnalysis::TSEdgeFunction;
+  enum { TOP = 42, UNINIT = 0, OPENED = 1, CLOSED = 2, ERROR = 3, BOT = 13 };
+  CSTDFILEIOTypeStateDescription Desc;
+  TypeStateTransitionTable Table(Desc);
+  ASSERT_EQ(Table.getNumStates(), 6u);
+  ASSERT_FALSE(Table.getFunctionId("malloc"));
+  for (auto &F : Desc.getAPIFunctions()) {
+    for (auto S : Desc.getStates()) {
+      EXPECT_EQ(Table.getState(Table.getNextState(*Table.getFunctionId(F),
+                                                  Table.getStateIdx(S))),
+                Desc.getNextState(F, S));
+    }
+  }
+  auto Open = TSEF::createConstant(Table, OPENED);
+  auto Read = TSEF::createTransition(Table, *Table.getFunctionId("fread"));
+  auto Close = TSEF::createTransition(Table, *Table.getFunctionId("fclose"));
+  EXPECT_EQ(Close->computeTarget(OPENED), CLOSED);
+  EXPECT_EQ(Close->computeTarget(TOP), TOP);
+  EXPECT_EQ(Close->computeTarget(BOT), BOT);
+  EXPECT_EQ(Open->composeWith(Close)->computeTarget(BOT), CLOSED);
+  EXPECT_EQ(Open->composeWith(Close)->composeWith(Close)->computeTarget(BOT),
+            ERROR);
+  EXPECT_TRUE(Read->composeWith(Close)->equal_to(
+      TSEF::createTransition(Table, *Table.getFunctionId("fwrite"))
+          ->composeWith(Close)));
+  // joining the identity and fread() keeps an opened file opened
+  auto Loop = EdgeIdentity<int>::getInstance()->joinWith(Read);
+  EXPECT_EQ(Loop->computeTarget(OPENED), OPENED);
+  EXPECT_EQ(Loop->computeTarget(UNINIT), BOT);
+  EXPECT_EQ(Open->composeWith(Loop)->composeWith(Close)->computeTarget(TOP),
+            CLOSED);
+  EXPECT_EQ(Close->joinWith(Read)->computeTarget(OPENED), BOT);
+  EXPECT_TRUE(Close->joinWith(Close)->equal_to(Close));
+}
+
 // main function for the test case
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
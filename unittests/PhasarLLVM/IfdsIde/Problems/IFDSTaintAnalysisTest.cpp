@@ -2,6 +2,7 @@
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSTaintAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/BitVectorIFDSSolver.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIFDSSolver.h>
 #include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
@@ -135,6 +136,52 @@ TEST_F(IFDSTaintAnalysisTest, TaintTest_06) {
   compareResults(GroundTruth);
 }
 
+TEST_F(IFDSTaintAnalysisTest, TaintTest_04_MaxLeaks) {
+  Initialize({pathToLLFiles + "dummy_source_sink/taint_04_cpp_dbg.ll"});
+  TaintProblem->MaxLeaks = 1;
+  LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> TaintSolver(
+      *TaintProblem, false, true);
+  TaintSolver.solve();
+  // the solver stops as soon as the first of the two leaks has been found
+  EXPECT_TRUE(TaintSolver.terminatedEarly());
+  EXPECT_EQ(TaintProblem->Leaks.size(), 1u);
+}
+
+TEST_F(IFDSTaintAnalysisTest, TaintTest_04_Sparse) {
+  Initialize({pathToLLFiles + "dummy_source_sink/taint_04_cpp_dbg.ll"});
+  TaintProblem->solver_config.sparsePropagation = true;
+  LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> TaintSolver(
+      *TaintProblem, false, true);
+  TaintSolver.solve();
+  map<int, set<string>> GroundTruth;
+  GroundTruth[19] = set<string>{"18"};
+  GroundTruth[24] = set<string>{"23"};
+  compareResults(GroundTruth);
+}
+
+TEST_F(IFDSTaintAnalysisTest, TaintTest_04_BitVector) {
+  Initialize({pathToLLFiles + "dummy_source_sink/taint_04_cpp_dbg.ll"});
+  BitVectorIFDSSolver<const llvm::Instruction *, const llvm::Value *,
+                      const llvm::Function *, LLVMBasedICFG &>
+      TaintSolver(*TaintProblem);
+  TaintSolver.solve();
+  map<int, set<string>> GroundTruth;
+  GroundTruth[19] = set<string>{"18"};
+  GroundTruth[24] = set<string>{"23"};
+  compareResults(GroundTruth);
+}
+
+TEST_F(IFDSTaintAnalysisTest, TaintTest_06_BitVector) {
+  Initialize({pathToLLFiles + "dummy_source_sink/taint_06_cpp_m2r_dbg.ll"});
+  BitVectorIFDSSolver<const llvm::Instruction *, const llvm::Value *,
+                      const llvm::Function *, LLVMBasedICFG &>
+      TaintSolver(*TaintProblem);
+  TaintSolver.solve();
+  map<int, set<string>> GroundTruth;
+  GroundTruth[5] = set<string>{"main.0"};
+  compareResults(GroundTruth);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
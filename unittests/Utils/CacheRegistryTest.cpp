@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <phasar/Utils/CacheRegistry.h>
+#include <vector>
+
+using namespace psr;
+
+TEST(CacheRegistryTest, HandleSharedCaches) {
+  auto &Registry = CacheRegistry::getInstance();
+  Registry.clear();
+  int ScopeA, ScopeB;
+  unsigned Created = 0;
+  auto Create = [&Created] {
+    ++Created;
+    return std::make_shared<std::vector<int>>();
+  };
+  auto A1 = Registry.getOrCreate<std::vector<int>>(&ScopeA, "a", Create);
+  auto A2 = Registry.getOrCreate<std::vector<int>>(&ScopeA, "a", Create);
+  ASSERT_EQ(A1, A2);
+  ASSERT_EQ(Created, 1u);
+  // caches are distinguished by scope, name and type
+  auto B = Registry.getOrCreate<std::vector<int>>(&ScopeB, "a", Create);
+  auto C = Registry.getOrCreate<std::vector<int>>(&ScopeA, "c", Create);
+  auto D = Registry.getOrCreate<int>(&ScopeA, "a",
+                                     [] { return std::make_shared<int>(42); });
+  ASSERT_NE(A1, B);
+  ASSERT_NE(A1, C);
+  ASSERT_EQ(*D, 42);
+  ASSERT_EQ(Registry.size(), 4u);
+  Registry.release(&ScopeA);
+  ASSERT_EQ(Registry.size(), 1u);
+  A1->push_back(1);
+  auto A3 = Registry.getOrCreate<std::vector<int>>(&ScopeA, "a", Create);
+  ASSERT_NE(A1, A3);
+  ASSERT_TRUE(A3->empty());
+  Registry.clear();
+  ASSERT_EQ(Registry.size(), 0u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <phasar/Utils/Checkpoint.h>
+#include <string>
+
+using namespace psr;
+
+static const std::string CheckpointPath = "CheckpointTest.chkpt";
+
+TEST(CheckpointTest, HandleRoundTrip) {
+  {
+    CheckpointWriter Writer(CheckpointPath, 3);
+    Writer.writeInt(42);
+    Writer.writeString("main.3");
+    Writer.writeString("main.3");
+    Writer.writeString("");
+    Writer.writeInt(UINT64_MAX);
+    Writer.writeString("main.3");
+    Writer.commit();
+  }
+  CheckpointReader Reader(CheckpointPath, 3);
+  EXPECT_EQ(42u, Reader.readInt());
+  EXPECT_EQ("main.3", Reader.readString());
+  EXPECT_EQ("main.3", Reader.readString());
+  EXPECT_EQ("", Reader.readString());
+  EXPECT_EQ(UINT64_MAX, Reader.readInt());
+  EXPECT_EQ("main.3", Reader.readString());
+  EXPECT_THROW(Reader.readInt(), std::ios_base::failure);
+  std::remove(CheckpointPath.c_str());
+}
+
+TEST(CheckpointTest, HandleUncommittedCheckpoint) {
+  {
+    CheckpointWriter Writer(CheckpointPath, 1);
+    Writer.writeInt(1);
+    Writer.commit();
+  }
+  {
+    CheckpointWriter Writer(CheckpointPath, 1);
+    Writer.writeInt(2);
+  }
+  // the previous checkpoint survives
+  CheckpointReader Reader(CheckpointPath, 1);
+  EXPECT_EQ(1u, Reader.readInt());
+  EXPECT_FALSE(std::ifstream(CheckpointPath + ".tmp").good());
+  std::remove(CheckpointPath.c_str());
+}
+
+TEST(CheckpointTest, HandleInvalidFiles) {
+  EXPECT_THROW(CheckpointReader("does/not/exist.chkpt", 1),
+               std::ios_base::failure);
+  {
+    CheckpointWriter Writer(CheckpointPath, 1);
+    Writer.commit();
+  }
+  EXPECT_THROW(CheckpointReader Reader(CheckpointPath, 2),
+               std::ios_base::failure);
+  {
+    std::ofstream File(CheckpointPath);
+    File << "not a checkpoint";
+  }
+  EXPECT_THROW(CheckpointReader Reader(CheckpointPath, 1),
+               std::ios_base::failure);
+  std::remove(CheckpointPath.c_str());
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <phasar/Utils/FlatHashMap.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace psr;
+
+TEST(FlatHashMapTest, HandleInsertAndFind) {
+  FlatHashMap<int, std::string> M;
+  ASSERT_EQ(M.find(1), nullptr);
+  ASSERT_TRUE(M.insert(1, "a").second);
+  ASSERT_FALSE(M.insert(1, "b").second);
+  ASSERT_EQ(*M.find(1), "a");
+  ASSERT_EQ(M.size(), 1u);
+  ASSERT_EQ(M.find(2), nullptr);
+}
+
+TEST(FlatHashMapTest, HandleGrowthAndErase) {
+  // compare against std::map under inserts and erasures that cause many
+  // collisions of aligned pointer-like keys
+  FlatHashMap<uintptr_t, int> M;
+  std::map<uintptr_t, int> Expected;
+  for (int I = 0; I < 2000; ++I) {
+    M.insert(static_cast<uintptr_t>(I) * 16, I);
+    Expected[static_cast<uintptr_t>(I) * 16] = I;
+  }
+  for (int I = 0; I < 2000; I += 3) {
+    ASSERT_TRUE(M.erase(static_cast<uintptr_t>(I) * 16));
+    Expected.erase(static_cast<uintptr_t>(I) * 16);
+  }
+  ASSERT_FALSE(M.erase(1));
+  ASSERT_EQ(M.size(), Expected.size());
+  for (int I = 0; I < 2000; ++I) {
+    auto *Value = M.find(static_cast<uintptr_t>(I) * 16);
+    if (I % 3 == 0) {
+      ASSERT_EQ(Value, nullptr);
+    } else {
+      ASSERT_NE(Value, nullptr);
+      ASSERT_EQ(*Value, I);
+    }
+  }
+  size_t Visited = 0;
+  M.forEach([&](uintptr_t Key, int Value) {
+    ASSERT_EQ(Expected.at(Key), Value);
+    ++Visited;
+  });
+  ASSERT_EQ(Visited, Expected.size());
+}
+
+TEST(FlatHashMapTest, HandleTupleKeys) {
+  FlatHashMap<std::tuple<int, int>, int, TupleHash> M;
+  M.insert(std::make_tuple(1, 2), 12);
+  M.insert(std::make_tuple(2, 1), 21);
+  ASSERT_EQ(*M.find(std::make_tuple(1, 2)), 12);
+  ASSERT_EQ(*M.find(std::make_tuple(2, 1)), 21);
+  M.clear();
+  ASSERT_TRUE(M.empty());
+  ASSERT_EQ(M.find(std::make_tuple(1, 2)), nullptr);
+}
+
+TEST(FlatHashMapTest, HandleEraseIf) {
+  FlatHashMap<int, int> M;
+  for (int I = 0; I < 100; ++I) {
+    M.insert(I, I % 4);
+  }
+  ASSERT_EQ(M.eraseIf([](int, int Value) { return Value == 0; }), 25u);
+  ASSERT_EQ(M.size(), 75u);
+  ASSERT_EQ(M.find(8), nullptr);
+  ASSERT_EQ(*M.find(9), 1);
+  // second chance: entries with a set flag survive the first round
+  size_t Hand = 0;
+  std::vector<int> Victims;
+  for (int Round = 0; Round < 75; ++Round) {
+    ASSERT_TRUE(M.eraseNextIf(Hand, [&](int Key, int &Value) {
+      if (Value == 3) {
+        Value = 0;
+        return false;
+      }
+      Victims.push_back(Key);
+      return true;
+    }));
+  }
+  ASSERT_TRUE(M.empty());
+  ASSERT_FALSE(M.eraseNextIf(Hand, [](int, int &) { return true; }));
+  // all entries without a set flag are evicted before the flagged ones
+  for (size_t Idx = 0; Idx < 50; ++Idx) {
+    ASSERT_NE(Victims[Idx] % 4, 3);
+  }
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
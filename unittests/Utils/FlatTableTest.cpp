@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <phasar/Utils/FlatTable.h>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+using namespace psr;
+
+TEST(FlatTableTest, HandleInsertAndFind) {
+  FlatTable<int, std::string, int> T;
+  ASSERT_TRUE(T.empty());
+  T.insert(1, "a", 10);
+  T.insert(1, "b", 11);
+  T.insert(2, "a", 20);
+  T.insert(1, "a", 12);
+  ASSERT_EQ(T.size(), 3u);
+  ASSERT_EQ(*T.find(1, "a"), 12);
+  ASSERT_EQ(T.find(2, "b"), nullptr);
+  ASSERT_TRUE(T.containsRow(2));
+  ASSERT_FALSE(T.containsRow(3));
+  ASSERT_TRUE(T.containsColumn("b"));
+  T.get(3, "c") += 5;
+  ASSERT_EQ(*T.find(3, "c"), 5);
+  ASSERT_EQ(T.row(1), (std::unordered_map<std::string, int>{{"a", 12},
+                                                            {"b", 11}}));
+  ASSERT_EQ(T.column("a"), (std::unordered_map<int, int>{{1, 12}, {2, 20}}));
+}
+
+TEST(FlatTableTest, HandleRemove) {
+  // compare rows, columns and cells against a std::map under many removals,
+  // which move cells around within the table
+  for (bool IndexColumns : {false, true}) {
+    FlatTable<int, int, int> T(IndexColumns);
+    std::map<std::tuple<int, int>, int> Expected;
+    for (int R = 0; R < 40; ++R) {
+      for (int C = 0; C < 40; ++C) {
+        T.insert(R, C, R * 100 + C);
+        Expected[std::make_tuple(R, C)] = R * 100 + C;
+      }
+    }
+    for (int R = 0; R < 40; ++R) {
+      for (int C = 0; C < 40; ++C) {
+        if ((R * 7 + C * 3) % 4 != 0 || C == 5) {
+          ASSERT_TRUE(T.remove(R, C));
+          Expected.erase(std::make_tuple(R, C));
+        }
+      }
+    }
+    ASSERT_FALSE(T.remove(0, 5));
+    ASSERT_EQ(T.size(), Expected.size());
+    std::map<std::tuple<int, int>, int> Cells;
+    for (auto &Cell : T) {
+      Cells[std::make_tuple(Cell.r, Cell.c)] = Cell.v;
+    }
+    ASSERT_EQ(Cells, Expected);
+    for (int Key = 0; Key < 40; ++Key) {
+      std::map<int, int> Row, Column;
+      T.foreachInRow(Key, [&Row](int C, int V) { Row[C] = V; });
+      T.foreachInColumn(Key, [&Column](int R, int V) { Column[R] = V; });
+      for (auto &Entry : Expected) {
+        if (std::get<0>(Entry.first) == Key) {
+          ASSERT_EQ(Row[std::get<1>(Entry.first)], Entry.second);
+        }
+        if (std::get<1>(Entry.first) == Key) {
+          ASSERT_EQ(Column[std::get<0>(Entry.first)], Entry.second);
+        }
+      }
+      ASSERT_EQ(T.containsColumn(Key), !Column.empty());
+      ASSERT_EQ(T.containsRow(Key), !Row.empty());
+    }
+    ASSERT_FALSE(T.containsColumn(5));
+    T.clear();
+    ASSERT_TRUE(T.empty());
+    ASSERT_FALSE(T.containsRow(0));
+  }
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/Interner.h>
+#include <string>
+
+using namespace psr;
+
+TEST(InternerTest, HandleDenseIds) {
+  Interner<std::string> I;
+  ASSERT_EQ(I.getId("a"), 0u);
+  ASSERT_EQ(I.getId("b"), 1u);
+  ASSERT_EQ(I.getId("a"), 0u);
+  ASSERT_EQ(I.getId("c"), 2u);
+  ASSERT_EQ(I.size(), 3u);
+  ASSERT_EQ(I.get(1), "b");
+}
+
+TEST(InternerTest, HandleFindId) {
+  Interner<int> I(true);
+  ASSERT_FALSE(I.findId(42).has_value());
+  I.getId(42);
+  ASSERT_EQ(I.findId(42), std::optional<uint32_t>(0));
+  ASSERT_EQ(I.size(), 1u);
+  I.clear();
+  ASSERT_FALSE(I.findId(42).has_value());
+}
+
+TEST(InternerTest, HandlePackIds) {
+  ASSERT_EQ(packIds(1, 2), (uint64_t(1) << 32) | 2);
+  ASSERT_NE(packIds(1, 2), packIds(2, 1));
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <phasar/Utils/MonotonicArena.h>
+#include <thread>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+// mimics a small flow function, e.g. a ZeroedFlowFunction wrapper
+struct Function {
+  virtual ~Function() = default;
+  virtual int apply(int Source) const = 0;
+};
+
+struct AddFunction : Function {
+  std::shared_ptr<Function> Next;
+  int Summand;
+  AddFunction(std::shared_ptr<Function> Next, int Summand)
+      : Next(std::move(Next)), Summand(Summand) {}
+  int apply(int Source) const override {
+    return Next ? Next->apply(Source + Summand) : Source + Summand;
+  }
+};
+
+unsigned Destroyed = 0;
+
+struct Counted {
+  ~Counted() { ++Destroyed; }
+};
+
+} // namespace
+
+TEST(MonotonicArenaTest, HandleAllocation) {
+  MonotonicArena Arena(1, 64);
+  std::vector<void *> Blocks;
+  for (size_t I = 1; I <= 100; ++I) {
+    void *P = Arena.allocate(I, alignof(std::max_align_t));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(P) % alignof(std::max_align_t), 0u);
+    Blocks.push_back(P);
+  }
+  // the blocks must not overlap
+  for (size_t I = 1; I < Blocks.size(); ++I) {
+    ASSERT_NE(Blocks[I - 1], Blocks[I]);
+  }
+  ASSERT_EQ(Arena.getBytesAllocated(), 5050u);
+  // over-aligned blocks are padded
+  void *P = Arena.allocate(8, 256);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(P) % 256, 0u);
+  ASSERT_EQ(Arena.getBytesAllocated(), 5058u);
+  ASSERT_TRUE(ArenaAllocator<int>(&Arena) == ArenaAllocator<char>(&Arena));
+  MonotonicArena Other;
+  ASSERT_TRUE(ArenaAllocator<int>(&Arena) != ArenaAllocator<int>(&Other));
+}
+
+TEST(MonotonicArenaTest, HandleSharedObjects) {
+  MonotonicArena Arena;
+  Destroyed = 0;
+  {
+    auto F = Arena.makeShared<AddFunction>(nullptr, 1);
+    std::shared_ptr<Function> G = Arena.makeShared<AddFunction>(F, 2);
+    ASSERT_EQ(G->apply(3), 6);
+    auto C = Arena.makeShared<Counted>();
+    ASSERT_GT(Arena.getBytesAllocated(), 0u);
+  }
+  // objects are still destroyed, only their memory is kept
+  ASSERT_EQ(Destroyed, 1u);
+}
+
+TEST(MonotonicArenaTest, HandleConcurrentAllocation) {
+  MonotonicArena Arena(4);
+  std::vector<std::thread> Threads;
+  std::vector<std::vector<std::shared_ptr<Function>>> Functions(4);
+  for (size_t T = 0; T < 4; ++T) {
+    Threads.emplace_back([&Arena, &Functions, T] {
+      for (int I = 0; I < 1000; ++I) {
+        Functions[T].push_back(Arena.makeShared<AddFunction>(nullptr, I));
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  for (auto &Fs : Functions) {
+    for (int I = 0; I < 1000; ++I) {
+      ASSERT_EQ(Fs[I]->apply(0), I);
+    }
+  }
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <phasar/Utils/PAMM.h>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace psr;
 
@@ -39,11 +41,31 @@ TEST_F(PAMMTest, HandleCounter) {
   pamm.incCounter("second");
   pamm.incCounter("third", 2);
   pamm.decCounter("third", 2);
+  pamm.regCounter("first");
   EXPECT_EQ(pamm.getCounter("first"), 42);
   EXPECT_EQ(pamm.getCounter("second"), 2);
   EXPECT_EQ(pamm.getCounter("third"), 0);
 }
 
+TEST_F(PAMMTest, HandleConcurrentCounter) {
+  PAMM &pamm = PAMM::getInstance();
+  pamm.regCounter("concurrent");
+  pamm.regHistogram("histogram");
+  std::vector<std::thread> Threads;
+  for (int T = 0; T < 4; ++T) {
+    Threads.emplace_back([&pamm]() {
+      for (int I = 0; I < 10000; ++I) {
+        pamm.incCounter("concurrent");
+        pamm.addToHistogram("histogram", std::to_string(I % 10));
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  EXPECT_EQ(pamm.getCounter("concurrent"), 40000);
+}
+
 TEST_F(PAMMTest, HandleJSONOutput) {
   PAMM &pamm = PAMM::getInstance();
   pamm.regCounter("timerCount");
@@ -0,0 +1,57 @@
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <phasar/Utils/ResultStore.h>
+#include <string>
+
+using namespace psr;
+
+static const std::string StorePath = "ResultStoreTest.store";
+
+TEST(ResultStoreTest, HandleRoundTrip) {
+  {
+    ResultStoreWriter Writer(StorePath);
+    Writer.beginFunction("main");
+    Writer.beginNode("3");
+    Writer.addResult("%x", "42");
+    Writer.addResult("%a", "Top");
+    Writer.beginNode("1");
+    Writer.beginFunction("foo");
+    Writer.beginNode("7");
+    Writer.addResult("%a", "13");
+    Writer.finish();
+  }
+  ResultStore Store(StorePath);
+  EXPECT_EQ(3u, Store.size());
+  EXPECT_EQ(std::vector<std::string_view>({"main", "foo"}), Store.functions());
+  EXPECT_EQ(std::vector<std::string_view>({"3", "1"}), Store.nodesOf("main"));
+  EXPECT_TRUE(Store.nodesOf("bar").empty());
+  EXPECT_EQ("42", Store.resultAt("3", "%x").value());
+  EXPECT_EQ("Top", Store.resultAt("3", "%a").value());
+  EXPECT_EQ("13", Store.resultAt("7", "%a").value());
+  EXPECT_FALSE(Store.resultAt("7", "%x"));
+  EXPECT_FALSE(Store.resultAt("1", "%a"));
+  EXPECT_FALSE(Store.resultAt("5", "%a"));
+  // results are ordered by the order in which the facts have been seen
+  std::vector<std::pair<std::string_view, std::string_view>> Results(
+      {{"%x", "42"}, {"%a", "Top"}});
+  EXPECT_EQ(Results, Store.resultsAt("3"));
+  EXPECT_TRUE(Store.resultsAt("1").empty());
+  std::remove(StorePath.c_str());
+}
+
+TEST(ResultStoreTest, HandleInvalidFiles) {
+  EXPECT_THROW(ResultStore("does/not/exist.store"), std::ios_base::failure);
+  {
+    std::ofstream File(StorePath);
+    File << "not a result store";
+  }
+  EXPECT_THROW(ResultStore Store(StorePath), std::ios_base::failure);
+  std::remove(StorePath.c_str());
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}